@@ -1,6 +1,8 @@
 ﻿using Coral.Managed.Interop;
 
 using System;
+using System.Collections.Concurrent;
+using System.Collections.Frozen;
 using System.Collections.Generic;
 using System.IO;
 using System.IO.MemoryMappedFiles;
@@ -20,14 +22,20 @@ public enum AssemblyLoadStatus
 public static class AssemblyLoader
 {
 	// NOTE(Emily): Visible to `TypeInterface.cs`.
-	public static readonly Dictionary<int, AssemblyLoadContext?> s_AssemblyContexts = new();
-	private static Dictionary<int, string[]> s_AlcDllPaths = new();
-
-	private static readonly Dictionary<Type, AssemblyLoadStatus> s_AssemblyLoadErrorLookup = new();
-	private static readonly Dictionary<int, Dictionary<int, Assembly>> s_AssemblyCache = new();
-#if DEBUG
-	private static readonly Dictionary<int, List<GCHandle>> s_AllocatedHandles = new();
-#endif
+	public static readonly ConcurrentDictionary<int, AssemblyLoadContext?> s_AssemblyContexts = new();
+	private static readonly ConcurrentDictionary<int, string[]> s_AlcDllPaths = new();
+
+	private static readonly FrozenDictionary<Type, AssemblyLoadStatus> s_AssemblyLoadErrorLookup = new Dictionary<Type, AssemblyLoadStatus>()
+	{
+		{ typeof(BadImageFormatException), AssemblyLoadStatus.InvalidAssembly },
+		{ typeof(FileNotFoundException), AssemblyLoadStatus.FileNotFound },
+		{ typeof(FileLoadException), AssemblyLoadStatus.FileLoadFailure },
+		{ typeof(ArgumentNullException), AssemblyLoadStatus.InvalidFilePath },
+		{ typeof(ArgumentException), AssemblyLoadStatus.InvalidFilePath },
+	}.ToFrozenDictionary();
+
+	// Read on every type and assembly resolve, possibly from several threads at once, so lookups have to stay lock-free
+	private static readonly ConcurrentDictionary<int, ConcurrentDictionary<int, Assembly>> s_AssemblyCache = new();
 	private static AssemblyLoadStatus s_LastLoadStatus = AssemblyLoadStatus.Success;
 
 	private static readonly int CORAL_ALC_CACHE_ID = -1;
@@ -35,16 +43,10 @@ public static class AssemblyLoader
 
 	static AssemblyLoader()
 	{
-		s_AssemblyLoadErrorLookup.Add(typeof(BadImageFormatException), AssemblyLoadStatus.InvalidAssembly);
-		s_AssemblyLoadErrorLookup.Add(typeof(FileNotFoundException), AssemblyLoadStatus.FileNotFound);
-		s_AssemblyLoadErrorLookup.Add(typeof(FileLoadException), AssemblyLoadStatus.FileLoadFailure);
-		s_AssemblyLoadErrorLookup.Add(typeof(ArgumentNullException), AssemblyLoadStatus.InvalidFilePath);
-		s_AssemblyLoadErrorLookup.Add(typeof(ArgumentException), AssemblyLoadStatus.InvalidFilePath);
-
 		s_CoralAssemblyLoadContext = AssemblyLoadContext.GetLoadContext(typeof(AssemblyLoader).Assembly);
 		s_CoralAssemblyLoadContext!.Resolving += ResolveAssembly;
 
-		s_AssemblyCache.Add(CORAL_ALC_CACHE_ID, new());
+		s_AssemblyCache.TryAdd(CORAL_ALC_CACHE_ID, new());
 
 		CacheCoralAssemblies();
 	}
@@ -54,13 +56,19 @@ public static class AssemblyLoader
 		foreach (var assembly in s_CoralAssemblyLoadContext!.Assemblies)
 		{
 			int assemblyId = assembly.GetName().Name!.GetHashCode();
-			s_AssemblyCache[CORAL_ALC_CACHE_ID].Add(assemblyId, assembly);
+			s_AssemblyCache[CORAL_ALC_CACHE_ID].TryAdd(assemblyId, assembly);
 		}
 	}
 
 	internal static bool TryGetAssembly(int InAssemblyLoadContextId, int InAssemblyId, out Assembly? OutAssembly)
 	{
-		return s_AssemblyCache[InAssemblyLoadContextId].TryGetValue(InAssemblyId, out OutAssembly);
+		if (!s_AssemblyCache.TryGetValue(InAssemblyLoadContextId, out var assemblies))
+		{
+			OutAssembly = null;
+			return false;
+		}
+
+		return assemblies.TryGetValue(InAssemblyId, out OutAssembly);
 	}
 
 	internal static Assembly? ResolveAssembly(AssemblyLoadContext? InAssemblyLoadContext, AssemblyName InAssemblyName)
@@ -120,7 +128,7 @@ public static class AssemblyLoader
 				if (assembly.GetName().Name != InAssemblyName.Name)
 					continue;
 
-				s_AssemblyCache[alcId].Add(assemblyId, assembly);
+				s_AssemblyCache[alcId].TryAdd(assemblyId, assembly);
 				return assembly;
 			}
 		}
@@ -167,15 +175,15 @@ public static class AssemblyLoader
 
 		var alc = new AssemblyLoadContext(name, true);
 		alc.Resolving += ResolveAssembly;
-		alc.Unloading += ctx => s_AssemblyCache.Remove(ctx.Name!.GetHashCode());
+		alc.Unloading += ctx => s_AssemblyCache.TryRemove(ctx.Name!.GetHashCode(), out _);
 
 		int contextId = name.GetHashCode();
-		s_AssemblyContexts.Add(contextId, alc);
-		s_AssemblyCache.Add(contextId, new());
+		s_AssemblyContexts.TryAdd(contextId, alc);
+		s_AssemblyCache.TryAdd(contextId, new());
 
 		var path = InDllPath.ToString();
 		LogMessage($"Added ALC '{name}' with ID '{contextId}'", MessageLevel.Trace);
-		s_AlcDllPaths.Add(contextId, (path ?? "").Split(':'));
+		s_AlcDllPaths.TryAdd(contextId, (path ?? "").Split(':'));
 
 		return contextId;
 	}
@@ -195,57 +203,29 @@ public static class AssemblyLoader
 			return;
 		}
 
-#if DEBUG
-		foreach (var assembly in alc.Assemblies)
-		{
-			var assemblyName = assembly.GetName();
-			int assemblyId = assemblyName.Name!.GetHashCode();
-
-			if (!s_AllocatedHandles.TryGetValue(assemblyId, out var handles))
-			{
-				continue;
-			}
-
-			// If everything is working properly, then there should not be anything left kicking around in the handles list.
-			// If you see messages here, it probably means you are mis-managing the lifetime of unmanaged resources.
-			// Managed objects that wrap an unmanaged resource need to implement IDisposable, and be Dispose()'d properly.
-			// Example:
-			//    // SceneQueryHitInterop wraps an unmanaged resource. It needs to implement IDisposable
-			//    using(SceneQueryHitInterop hit = new())
-			//    {
-			//        Physics.CastRay(ray, out hit);   // Calls into native code, populates the unmanaged resource into hit
-			//
-			//        // Do something with hit
-			//
-			//    } // hit is Dispose()'d here
-			//
-			foreach (var handle in handles)
-			{
-				LogMessage($"Found still-registered handle '{(handle.Target is null? "null" : handle.Target)}' from assembly '{assemblyName}'", MessageLevel.Warning);
-
-				if (!handle.IsAllocated || handle.Target == null)
-				{
-					continue;
-				}
-
-				LogMessage($"Found unfreed object '{handle.Target}' from assembly '{assemblyName}'. Deallocating.", MessageLevel.Warning);
-				handle.Free();
-			}
-
-			s_AllocatedHandles.Remove(assemblyId);
-		}
-#endif
+		ObjectHandleTable.FreeObjectsFromContext(alc);
 
 		ManagedObject.s_CachedMethods.Clear();
+		CachedMethod.s_Handles.Clear();
+		CachedMethod.s_Methods.Clear();
+		ManagedObject.s_CachedConstructors.Clear();
+		CachedConstructor.s_Handles.Clear();
+		ManagedObject.s_CachedFields.Clear();
+		CachedField.s_Handles.Clear();
+		ManagedObject.s_CachedProperties.Clear();
+		CachedProperty.s_Handles.Clear();
+		Marshalling.s_ParameterTypes.Clear();
+		Marshalling.s_ValueWriters.Clear();
 
 		TypeInterface.s_CachedTypes.Clear();
 		TypeInterface.s_CachedMethods.Clear();
 		TypeInterface.s_CachedFields.Clear();
 		TypeInterface.s_CachedProperties.Clear();
 		TypeInterface.s_CachedAttributes.Clear();
+		TypeInterface.ClearOverloadIndices();
 
-		s_AssemblyContexts.Remove(InContextId);
-		s_AlcDllPaths.Remove(InContextId);
+		s_AssemblyContexts.TryRemove(InContextId, out _);
+		s_AlcDllPaths.TryRemove(InContextId, out _);
 		alc.Unload();
 	}
 
@@ -292,7 +272,7 @@ public static class AssemblyLoader
 			LogMessage($"Loading assembly '{InAssemblyFilePath}'", MessageLevel.Info);
 			var assemblyName = assembly.GetName();
 			int assemblyId = assemblyName.Name!.GetHashCode();
-			s_AssemblyCache[InContextId].Add(assemblyId, assembly);
+			s_AssemblyCache[InContextId].TryAdd(assemblyId, assembly);
 			s_LastLoadStatus = AssemblyLoadStatus.Success;
 			return assemblyId;
 		}
@@ -333,7 +313,7 @@ public static class AssemblyLoader
 			LogMessage($"Loading assembly '{assembly.FullName}'", MessageLevel.Info);
 			var assemblyName = assembly.GetName();
 			int assemblyId = assemblyName.Name!.GetHashCode();
-			s_AssemblyCache[InContextId].Add(assemblyId, assembly);
+			s_AssemblyCache[InContextId].TryAdd(assemblyId, assembly);
 			s_LastLoadStatus = AssemblyLoadStatus.Success;
 			return assemblyId;
 		}
@@ -360,40 +340,4 @@ public static class AssemblyLoader
 		var assemblyName = assembly.GetName();
 		return assemblyName.Name;
 	}
-
-#if DEBUG
-	// In DEBUG builds, we track all GCHandles that are allocated by the managed code,
-	// so that we can check that they've all been freed when the assembly is unloaded.
-	internal static void RegisterHandle(Assembly InAssembly, GCHandle InHandle)
-	{
-		var assemblyName = InAssembly.GetName();
-		int assemblyId = assemblyName.Name!.GetHashCode();
-
-		if (!s_AllocatedHandles.TryGetValue(assemblyId, out var handles))
-		{
-			s_AllocatedHandles.Add(assemblyId, new List<GCHandle>());
-			handles = s_AllocatedHandles[assemblyId];
-		}
-
-		handles.Add(InHandle);
-	}
-
-	internal static void DeregisterHandle(Assembly InAssembly, GCHandle InHandle)
-	{
-		var assemblyName = InAssembly.GetName();
-		int assemblyId = assemblyName.Name!.GetHashCode();
-
-		if (!s_AllocatedHandles.TryGetValue(assemblyId, out var handles))
-		{
-			return;
-		}
-
-		if (!InHandle.IsAllocated)
-		{
-			LogMessage($"AssemblyLoader de-registering an already freed object from assembly '{assemblyName}'", MessageLevel.Error);
-		}
-
-		handles.Remove(InHandle);
-	}
-#endif
 }
@@ -0,0 +1,82 @@
+using System;
+using System.Reflection;
+
+namespace Coral.Managed;
+
+internal sealed class CachedConstructor
+{
+	// Constructors that have been handed out to native code as a `Coral::ConstructorHandle`, indexed by handle.
+	internal static readonly DenseIdList<CachedConstructor> s_Handles = new();
+
+	public readonly Type Type;
+	public readonly ConstructorInfo Constructor;
+	public readonly int ParameterCount;
+
+	// Compiled factory, null if the object has to be created through reflection.
+	private readonly ObjectFactory? m_Factory;
+
+	private int m_Handle = -1;
+
+	public CachedConstructor(Type InType, ConstructorInfo InConstructor)
+	{
+		Type = InType;
+		Constructor = InConstructor;
+		ParameterCount = InConstructor.GetParameters().Length;
+
+		try
+		{
+			m_Factory = InvokerBuilder.BuildObjectFactory(InType, InConstructor);
+		}
+		catch (Exception ex)
+		{
+			ManagedHost.LogMessage($"Failed to compile factory for constructor '{InConstructor}' of type '{InType}', falling back to reflection. {ex.Message}", MessageLevel.Warning);
+			m_Factory = null;
+		}
+	}
+
+	public int GetOrCreateHandle()
+	{
+		if (m_Handle != -1)
+			return m_Handle;
+
+		lock (this)
+		{
+			if (m_Handle == -1)
+				m_Handle = s_Handles.Add(this);
+		}
+
+		return m_Handle;
+	}
+
+	public object? Create(IntPtr InParameters, int InParameterCount)
+	{
+		if (m_Factory != null)
+			return m_Factory(InParameters);
+
+		var parameters = Marshalling.RentParameterArray(InParameters, InParameterCount, Constructor);
+
+		try
+		{
+			object? result;
+
+			// NOTE: If the constructor was found on a base type we create the object with its default constructor first
+			if (Constructor.DeclaringType != Type || parameters == null)
+			{
+				result = TypeInterface.CreateInstance(Type);
+
+				if (Constructor.DeclaringType != Type)
+					Constructor.Invoke(result, parameters);
+			}
+			else
+			{
+				result = TypeInterface.CreateInstance(Type, parameters);
+			}
+
+			return result;
+		}
+		finally
+		{
+			Marshalling.ReturnParameterArray(parameters);
+		}
+	}
+}
@@ -0,0 +1,59 @@
+using System;
+using System.Reflection;
+
+namespace Coral.Managed;
+
+internal sealed class CachedField
+{
+	// Fields that have been handed out to native code as a `Coral::FieldAccessor`, indexed by handle.
+	internal static readonly DenseIdList<CachedField> s_Handles = new();
+
+	public readonly FieldInfo Field;
+
+	// Compiled accessors, null if the field has to be accessed through reflection.
+	private readonly MemberGetter? m_Getter;
+	private readonly MemberSetter? m_Setter;
+
+	public readonly int Handle;
+
+	public CachedField(FieldInfo InField)
+	{
+		Field = InField;
+
+		try
+		{
+			m_Getter = InvokerBuilder.BuildFieldGetter(InField);
+			m_Setter = InvokerBuilder.BuildFieldSetter(InField);
+		}
+		catch (Exception ex)
+		{
+			ManagedHost.LogMessage($"Failed to compile accessors for field '{InField}', falling back to reflection. {ex.Message}", MessageLevel.Warning);
+			m_Getter = null;
+			m_Setter = null;
+		}
+
+		Handle = s_Handles.Add(this);
+	}
+
+	public void GetValue(object InTarget, IntPtr OutValue)
+	{
+		if (m_Getter != null)
+		{
+			m_Getter(InTarget, OutValue);
+			return;
+		}
+
+		Marshalling.MarshalReturnValue(InTarget, Field.GetValue(InTarget), Field, OutValue);
+	}
+
+	public void SetValue(object InTarget, IntPtr InValue)
+	{
+		if (m_Setter != null)
+		{
+			m_Setter(InTarget, InValue);
+			return;
+		}
+
+		Field.SetValue(InTarget, Marshalling.MarshalPointer(InValue, Field.FieldType));
+	}
+}
@@ -0,0 +1,96 @@
+using System;
+using System.Collections.Concurrent;
+using System.Reflection;
+
+namespace Coral.Managed;
+
+internal sealed class CachedMethod
+{
+	// Methods that have been handed out to native code as a `Coral::MethodHandle`, indexed by handle.
+	internal static readonly DenseIdList<CachedMethod> s_Handles = new();
+
+	// Keyed by method handle rather than MethodInfo so that every subclass inheriting a method shares one compiled invoker.
+	// Instantiations of a generic type share the handles of their methods, so the declaring type is part of the key as well.
+	internal static readonly ConcurrentDictionary<(RuntimeMethodHandle, RuntimeTypeHandle), CachedMethod> s_Methods = new();
+
+	public readonly MethodInfo Method;
+	public readonly int ParameterCount;
+
+	// Compiled invoker that reads the native arguments directly, null if the method can only be called through reflection.
+	private readonly MethodInvoker? m_Invoker;
+
+	private int m_Handle = -1;
+
+	public CachedMethod(MethodInfo InMethod)
+	{
+		Method = InMethod;
+		ParameterCount = InMethod.GetParameters().Length;
+
+		try
+		{
+			m_Invoker = InvokerBuilder.BuildMethodInvoker(this);
+		}
+		catch (Exception ex)
+		{
+			ManagedHost.LogMessage($"Failed to compile invoker for method '{InMethod}', falling back to reflection. {ex.Message}", MessageLevel.Warning);
+			m_Invoker = null;
+		}
+	}
+
+	// Only called while resolving under ManagedObject.s_ResolveLock, so each invoker is only compiled once
+	public static CachedMethod GetOrCreate(MethodInfo InMethod)
+	{
+		var key = (InMethod.MethodHandle, InMethod.DeclaringType?.TypeHandle ?? default);
+		return s_Methods.GetOrAdd(key, static (_, method) => new CachedMethod(method), InMethod);
+	}
+
+	public int GetOrCreateHandle()
+	{
+		if (m_Handle != -1)
+			return m_Handle;
+
+		lock (this)
+		{
+			if (m_Handle == -1)
+				m_Handle = s_Handles.Add(this);
+		}
+
+		return m_Handle;
+	}
+
+	public void Invoke(object? InTarget, IntPtr InParameters, int InParameterCount, IntPtr InResultStorage)
+	{
+		if (m_Invoker != null)
+		{
+			m_Invoker(InTarget, InParameters, InResultStorage);
+			return;
+		}
+
+		var parameters = Marshalling.RentParameterArray(InParameters, InParameterCount, Method);
+
+		object? value;
+
+		try
+		{
+			value = Method.Invoke(InTarget, parameters);
+		}
+		finally
+		{
+			Marshalling.ReturnParameterArray(parameters);
+		}
+
+		if (InResultStorage == IntPtr.Zero || value == null)
+			return;
+
+		Marshalling.MarshalReturnValue(InTarget, value, Method, InResultStorage);
+	}
+
+	// Called by compiled invokers for return types that they can't write directly
+	internal void WriteReturnValue(object? InTarget, object? InValue, IntPtr InResultStorage)
+	{
+		if (InValue == null)
+			return;
+
+		Marshalling.MarshalReturnValue(InTarget, InValue, Method, InResultStorage);
+	}
+}
@@ -0,0 +1,62 @@
+using System;
+using System.Reflection;
+
+namespace Coral.Managed;
+
+internal sealed class CachedProperty
+{
+	// Properties that have been handed out to native code as a `Coral::PropertyAccessor`, indexed by handle.
+	internal static readonly DenseIdList<CachedProperty> s_Handles = new();
+
+	public readonly PropertyInfo Property;
+
+	// Compiled accessors, null if the property has to be accessed through reflection.
+	private readonly MemberGetter? m_Getter;
+	private readonly MemberSetter? m_Setter;
+
+	public readonly int Handle;
+
+	public CachedProperty(PropertyInfo InProperty)
+	{
+		Property = InProperty;
+
+		try
+		{
+			m_Getter = InvokerBuilder.BuildPropertyGetter(InProperty);
+			m_Setter = InvokerBuilder.BuildPropertySetter(InProperty);
+		}
+		catch (Exception ex)
+		{
+			ManagedHost.LogMessage($"Failed to compile accessors for property '{InProperty}', falling back to reflection. {ex.Message}", MessageLevel.Warning);
+			m_Getter = null;
+			m_Setter = null;
+		}
+
+		Handle = s_Handles.Add(this);
+	}
+
+	public bool CanRead => Property.GetMethod != null;
+	public bool CanWrite => Property.SetMethod != null;
+
+	public void GetValue(object InTarget, IntPtr OutValue)
+	{
+		if (m_Getter != null)
+		{
+			m_Getter(InTarget, OutValue);
+			return;
+		}
+
+		Marshalling.MarshalReturnValue(InTarget, Property.GetValue(InTarget), Property, OutValue);
+	}
+
+	public void SetValue(object InTarget, IntPtr InValue)
+	{
+		if (m_Setter != null)
+		{
+			m_Setter(InTarget, InValue);
+			return;
+		}
+
+		Property.SetValue(InTarget, Marshalling.MarshalPointer(InValue, Property.PropertyType));
+	}
+}
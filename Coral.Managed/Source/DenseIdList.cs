@@ -0,0 +1,133 @@
+using System;
+using System.Threading;
+
+namespace Coral.Managed;
+
+// Append-only list that hands out sequential IDs. Lookups are a single bounds-checked array index,
+// which makes it suitable for handles that native code passes back to us on every call.
+// IDs are never reused, Clear() starts a new block after the last ID so stale IDs held by native code fail the lookup
+// instead of silently resolving to whatever was added after the clear.
+public class DenseIdList<T> where T : class
+{
+	// The array and the ID of its first element are swapped together so readers never pair one with the other's old value
+	private sealed class Block
+	{
+		public readonly T?[] Objects;
+		public readonly int FirstId;
+
+		public Block(T?[] InObjects, int InFirstId)
+		{
+			Objects = InObjects;
+			FirstId = InFirstId;
+		}
+	}
+
+	private const int InitialCapacity = 64;
+
+	private Block m_Block;
+	private int m_Count;
+	private readonly object m_Lock = new();
+
+	public DenseIdList(int InFirstId = 0)
+	{
+		m_Block = new Block(new T?[InitialCapacity], InFirstId);
+	}
+
+	public int Count => Volatile.Read(ref m_Count);
+
+	public int Add(T InObject)
+	{
+		if (InObject == null)
+		{
+			throw new ArgumentNullException(nameof(InObject));
+		}
+
+		lock (m_Lock)
+		{
+			var block = m_Block;
+
+			if (m_Count == block.Objects.Length)
+			{
+				var newObjects = new T?[block.Objects.Length * 2];
+				Array.Copy(block.Objects, newObjects, block.Objects.Length);
+				block = new Block(newObjects, block.FirstId);
+			}
+
+			int index = m_Count;
+			block.Objects[index] = InObject;
+
+			// Publish the (possibly new) block before the count so readers never observe an ID they can't index.
+			Volatile.Write(ref m_Block, block);
+			Volatile.Write(ref m_Count, index + 1);
+			return block.FirstId + index;
+		}
+	}
+
+	// Hands out InCount sequential IDs without objects, each one stays unresolved until Set binds it. Returns the first ID.
+	public int Reserve(int InCount)
+	{
+		lock (m_Lock)
+		{
+			var block = m_Block;
+			int capacity = block.Objects.Length;
+
+			while (m_Count + InCount > capacity)
+				capacity *= 2;
+
+			if (capacity != block.Objects.Length)
+			{
+				var newObjects = new T?[capacity];
+				Array.Copy(block.Objects, newObjects, block.Objects.Length);
+				block = new Block(newObjects, block.FirstId);
+			}
+
+			int firstIndex = m_Count;
+			Volatile.Write(ref m_Block, block);
+			Volatile.Write(ref m_Count, firstIndex + InCount);
+			return block.FirstId + firstIndex;
+		}
+	}
+
+	// Binds a reserved ID, returns false if the ID wasn't handed out since the last Clear
+	public bool Set(int InId, T InObject)
+	{
+		lock (m_Lock)
+		{
+			var block = m_Block;
+			int index = InId - block.FirstId;
+
+			if ((uint)index >= (uint)m_Count)
+				return false;
+
+			// Add and Reserve only ever copy the block under the lock, so the write can't be lost to a concurrent resize
+			Volatile.Write(ref block.Objects[index], InObject);
+			return true;
+		}
+	}
+
+	public bool TryGetValue(int InId, out T? OutObject)
+	{
+		var block = Volatile.Read(ref m_Block);
+		var objects = block.Objects;
+		int index = InId - block.FirstId;
+
+		if ((uint)index >= (uint)objects.Length)
+		{
+			OutObject = null;
+			return false;
+		}
+
+		OutObject = objects[index];
+		return OutObject != null;
+	}
+
+	public void Clear()
+	{
+		lock (m_Lock)
+		{
+			var block = m_Block;
+			Volatile.Write(ref m_Block, new Block(new T?[InitialCapacity], block.FirstId + m_Count));
+			Volatile.Write(ref m_Count, 0);
+		}
+	}
+}
@@ -72,4 +72,51 @@ internal static class InternalCallsManager
 			HandleException(ex);
 		}
 	}
+
+	[UnmanagedCallersOnly]
+	internal static IntPtr GetNativeCallableFunctionPointer(int InAssemblyLoadContextId, int InAssemblyId, NativeString InTypeName, NativeString InMethodName)
+	{
+		try
+		{
+			string? typeName = InTypeName;
+			string? methodName = InMethodName;
+
+			if (!AssemblyLoader.TryGetAssembly(InAssemblyLoadContextId, InAssemblyId, out var assembly) || assembly == null)
+			{
+				LogMessage($"Cannot get function pointer for '{typeName}.{methodName}', failed to find assembly with id '{InAssemblyId}'.", MessageLevel.Error);
+				return IntPtr.Zero;
+			}
+
+			var type = assembly.GetType(typeName!);
+
+			if (type == null)
+			{
+				LogMessage($"Cannot get function pointer for '{typeName}.{methodName}', failed to find type '{typeName}'.", MessageLevel.Error);
+				return IntPtr.Zero;
+			}
+
+			var bindingFlags = BindingFlags.Static | BindingFlags.Public | BindingFlags.NonPublic;
+			var method = type.GetMethods(bindingFlags).FirstOrDefault(method => method.Name == methodName && method.GetCustomAttribute<NativeCallableAttribute>() != null);
+
+			if (method == null)
+			{
+				LogMessage($"Cannot get function pointer for '{typeName}.{methodName}', no static method with that name is marked [NativeCallable].", MessageLevel.Error);
+				return IntPtr.Zero;
+			}
+
+			if (method.GetCustomAttribute<UnmanagedCallersOnlyAttribute>() == null)
+			{
+				LogMessage($"Method '{typeName}.{methodName}' is marked [NativeCallable] but not [UnmanagedCallersOnly]!", MessageLevel.Error);
+				return IntPtr.Zero;
+			}
+
+			// NOTE: For [UnmanagedCallersOnly] methods this is the native entry point, so calling it costs a single transition.
+			return method.MethodHandle.GetFunctionPointer();
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return IntPtr.Zero;
+		}
+	}
 }
@@ -1,5 +1,6 @@
 ﻿using System;
 using System.Collections;
+using System.Collections.Concurrent;
 using System.Collections.Generic;
 using System.Diagnostics.CodeAnalysis;
 using System.Reflection;
@@ -136,7 +137,8 @@ public struct NativeArray<T> : IDisposable, IEnumerable<T>
 
 public static class ArrayStorage
 {
-	private static Dictionary<int, GCHandle> s_FieldArrays = new();
+	private static readonly ConcurrentDictionary<int, GCHandle> s_FieldArrays = new();
+	private static readonly object s_Lock = new();
 
 	public static bool HasFieldArray(object? InTarget, MemberInfo? InArrayMemberInfo)
 	{
@@ -156,42 +158,43 @@ public static class ArrayStorage
 		int arrayId = InArrayMemberInfo.GetHashCode();
 		arrayId += InTarget != null ? InTarget.GetHashCode() : 0;
 
-		if (!s_FieldArrays.TryGetValue(arrayId, out var arrayHandle))
+		if (s_FieldArrays.TryGetValue(arrayId, out var arrayHandle))
+			return arrayHandle;
+
+		// Locked so two threads reading the same field don't both pin the array
+		lock (s_Lock)
 		{
-			var arrayObject = InValue as Array;
-			arrayHandle = GCHandle.Alloc(arrayObject, GCHandleType.Pinned);
-			s_FieldArrays.Add(arrayId, arrayHandle);
-		}
+			if (!s_FieldArrays.TryGetValue(arrayId, out arrayHandle))
+			{
+				var arrayObject = InValue as Array;
+				arrayHandle = GCHandle.Alloc(arrayObject, GCHandleType.Pinned);
+				s_FieldArrays.TryAdd(arrayId, arrayHandle);
+			}
 
-		return arrayHandle;
+			return arrayHandle;
+		}
 	}
 }
 
-[StructLayout(LayoutKind.Sequential, Size=16, Pack=8)]
+[StructLayout(LayoutKind.Sequential, Size=24, Pack=8)]
 public struct NativeInstance<T> : IDisposable
 {
 	private IntPtr m_Handle;
 	private readonly IntPtr m_Unused;
+	private readonly IntPtr m_RefCount;
 
 	private NativeInstance(IntPtr handle)
 	{
 		m_Handle = handle;
 		m_Unused = IntPtr.Zero;
+		m_RefCount = IntPtr.Zero;
 	}
 
 	public void Dispose()
 	{
 		if (m_Handle != IntPtr.Zero)
 		{
-			var handle = GCHandle.FromIntPtr(m_Handle);
-#if DEBUG
-			var type = handle.Target?.GetType();
-			if (type is not null)
-			{
-				AssemblyLoader.DeregisterHandle(type.Assembly, handle);
-			}
-#endif
-			handle.Free();
+			ObjectHandleTable.Free(m_Handle);
 			m_Handle = IntPtr.Zero;
 		}
 		GC.SuppressFinalize(this);
@@ -202,17 +205,15 @@ public struct NativeInstance<T> : IDisposable
 		if (m_Handle == IntPtr.Zero)
 			return default;
 
-		GCHandle handle = GCHandle.FromIntPtr(m_Handle);
-
-		if (!(handle.Target is T))
+		if (ObjectHandleTable.Get(m_Handle) is not T target)
 			return default;
-		
-		return (T)handle.Target;
+
+		return target;
 	}
 
 	public static implicit operator NativeInstance<T>(T instance)
 	{
-		return new(GCHandle.ToIntPtr(GCHandle.Alloc(instance, GCHandleType.Normal)));
+		return new(ObjectHandleTable.Allocate(instance));
 	}
 
 	public static implicit operator T?(NativeInstance<T> InInstance)
@@ -0,0 +1,370 @@
+using Coral.Managed.Interop;
+
+using System;
+using System.Reflection;
+using System.Reflection.Emit;
+using System.Runtime.InteropServices;
+
+namespace Coral.Managed;
+
+// Signature of the compiled invokers, bound to the CachedMethod they were generated for.
+// InParameters is the native `const void**` argument array, InResultStorage may be IntPtr.Zero if the caller doesn't want the result.
+internal delegate void MethodInvoker(object? InTarget, IntPtr InParameters, IntPtr InResultStorage);
+
+// Compiled accessors for fields and properties, InValue / OutValue point to native memory in the same format the name based accessors use.
+internal delegate void MemberGetter(object InTarget, IntPtr OutValue);
+internal delegate void MemberSetter(object InTarget, IntPtr InValue);
+
+internal delegate object ObjectFactory(IntPtr InParameters);
+
+internal static class InvokerBuilder
+{
+	private static readonly MethodInfo s_ReadStringMethod = typeof(InvokerBuilder).GetMethod(nameof(ReadString), BindingFlags.NonPublic | BindingFlags.Static)!;
+	private static readonly MethodInfo s_ReadObjectMethod = typeof(InvokerBuilder).GetMethod(nameof(ReadObject), BindingFlags.NonPublic | BindingFlags.Static)!;
+	private static readonly MethodInfo s_ReadParameterMethod = typeof(InvokerBuilder).GetMethod(nameof(ReadParameter), BindingFlags.NonPublic | BindingFlags.Static)!;
+	private static readonly MethodInfo s_WriteStringMethod = typeof(InvokerBuilder).GetMethod(nameof(WriteString), BindingFlags.NonPublic | BindingFlags.Static)!;
+	private static readonly MethodInfo s_WriteReturnValueMethod = typeof(CachedMethod).GetMethod(nameof(CachedMethod.WriteReturnValue), BindingFlags.NonPublic | BindingFlags.Instance)!;
+	private static readonly MethodInfo s_GetTypeFromHandleMethod = typeof(Type).GetMethod(nameof(Type.GetTypeFromHandle))!;
+
+	private static unsafe string? ReadString(IntPtr InValue) => *(NativeString*)InValue;
+
+	private static object? ReadObject(IntPtr InValue)
+	{
+		var handlePtr = Marshal.ReadIntPtr(InValue);
+		return handlePtr == IntPtr.Zero ? null : ObjectHandleTable.Get(handlePtr);
+	}
+
+	private static object? ReadParameter(IntPtr InValue, Type InType) => Marshalling.MarshalPointer(InValue, InType);
+
+	private static unsafe void WriteString(IntPtr OutValue, string? InValue)
+	{
+		if (InValue == null)
+			return;
+
+		*(NativeString*)OutValue = InValue;
+	}
+
+	// Types that have the same layout in native and managed memory, which means we can read and write them with a plain ldobj / stobj.
+	// NOTE: bool and char are excluded because the marshaller treats them as 4 and 1 byte values inside of structs respectively.
+	internal static bool IsBlittable(Type InType)
+	{
+		if (InType.IsPointer || InType == typeof(IntPtr) || InType == typeof(UIntPtr))
+			return true;
+
+		if (InType.IsEnum)
+			return true;
+
+		if (InType.IsPrimitive)
+			return InType != typeof(bool) && InType != typeof(char);
+
+		if (!InType.IsValueType || InType.IsGenericType || InType.IsAutoLayout)
+			return false;
+
+		foreach (var field in InType.GetFields(BindingFlags.Instance | BindingFlags.Public | BindingFlags.NonPublic))
+		{
+			if (!IsBlittable(field.FieldType))
+				return false;
+		}
+
+		return true;
+	}
+
+	internal static bool CanCompile(MethodInfo InMethod)
+	{
+		if (InMethod.ContainsGenericParameters || InMethod.ReturnType.IsByRef)
+			return false;
+
+		if (InMethod.DeclaringType == null || InMethod.DeclaringType.ContainsGenericParameters)
+			return false;
+
+		foreach (var parameter in InMethod.GetParameters())
+		{
+			if (parameter.ParameterType.IsByRef)
+				return false;
+		}
+
+		return true;
+	}
+
+	// Emits IL that reads the value pointed to by the pointer on top of the stack and leaves it on the stack as InType
+	private static void EmitLoadValue(ILGenerator InIL, Type InType)
+	{
+		if (InType == typeof(bool))
+		{
+			// NOTE: Reading a single byte works for both bool and Bool32 values
+			InIL.Emit(OpCodes.Ldind_U1);
+			InIL.Emit(OpCodes.Ldc_I4_0);
+			InIL.Emit(OpCodes.Cgt_Un);
+		}
+		else if (InType == typeof(string))
+		{
+			InIL.Emit(OpCodes.Call, s_ReadStringMethod);
+		}
+		else if (IsBlittable(InType))
+		{
+			InIL.Emit(OpCodes.Ldobj, InType);
+		}
+		else if (InType.IsClass && !InType.IsSZArray && !InType.IsGenericType)
+		{
+			InIL.Emit(OpCodes.Call, s_ReadObjectMethod);
+			InIL.Emit(OpCodes.Castclass, InType);
+		}
+		else
+		{
+			// Arrays, NativeArray<T> and non-blittable structs go through the regular marshalling code
+			InIL.Emit(OpCodes.Ldtoken, InType);
+			InIL.Emit(OpCodes.Call, s_GetTypeFromHandleMethod);
+			InIL.Emit(OpCodes.Call, s_ReadParameterMethod);
+			InIL.Emit(OpCodes.Unbox_Any, InType);
+		}
+	}
+
+	// Emits IL that reads the native argument at InIndex from the argument array passed as argument InArrayArgument,
+	// and leaves it on the stack as InType
+	private static void EmitLoadParameter(ILGenerator InIL, Type InType, int InIndex, short InArrayArgument)
+	{
+		// Load the pointer that native code stored in the argument array
+		InIL.Emit(OpCodes.Ldarg, InArrayArgument);
+
+		if (InIndex > 0)
+		{
+			InIL.Emit(OpCodes.Ldc_I4, InIndex * IntPtr.Size);
+			InIL.Emit(OpCodes.Add);
+		}
+
+		InIL.Emit(OpCodes.Ldind_I);
+
+		// Pointers are passed by value, everything else is passed as a pointer to the value
+		if (InType.IsPointer || InType == typeof(IntPtr))
+			return;
+
+		EmitLoadValue(InIL, InType);
+	}
+
+	// Types that EmitStoreValue can write without going through the reflection based marshalling code
+	private static bool CanStoreValue(Type InType) => InType == typeof(bool) || InType == typeof(string) || IsBlittable(InType);
+
+	// Emits IL that writes the value on top of the stack to the destination pointer below it
+	private static void EmitStoreValue(ILGenerator InIL, Type InType)
+	{
+		if (InType == typeof(bool))
+		{
+			// Native code expects a Bool32
+			InIL.Emit(OpCodes.Stind_I4);
+		}
+		else if (InType == typeof(string))
+		{
+			InIL.Emit(OpCodes.Call, s_WriteStringMethod);
+		}
+		else
+		{
+			InIL.Emit(OpCodes.Stobj, InType);
+		}
+	}
+
+	// Emits IL that writes the value stored in InLocal to the result storage
+	private static void EmitStoreReturnValue(ILGenerator InIL, Type InType, LocalBuilder InLocal)
+	{
+		if (CanStoreValue(InType))
+		{
+			InIL.Emit(OpCodes.Ldarg_3);
+			InIL.Emit(OpCodes.Ldloc, InLocal);
+			EmitStoreValue(InIL, InType);
+		}
+		else
+		{
+			// Arrays and non-blittable types are handed to the reflection based marshalling code
+			InIL.Emit(OpCodes.Ldarg_0);
+			InIL.Emit(OpCodes.Ldarg_1);
+			InIL.Emit(OpCodes.Ldloc, InLocal);
+
+			if (InType.IsValueType)
+				InIL.Emit(OpCodes.Box, InType);
+
+			InIL.Emit(OpCodes.Ldarg_3);
+			InIL.Emit(OpCodes.Call, s_WriteReturnValueMethod);
+		}
+	}
+
+	// Emits IL that converts the object argument at InIndex to InDeclaringType so its members can be accessed
+	private static void EmitLoadTarget(ILGenerator InIL, Type InDeclaringType, short InIndex)
+	{
+		InIL.Emit(OpCodes.Ldarg, InIndex);
+
+		if (InDeclaringType.IsValueType)
+			InIL.Emit(OpCodes.Unbox, InDeclaringType);
+		else
+			InIL.Emit(OpCodes.Castclass, InDeclaringType);
+	}
+
+	internal static MethodInvoker? BuildMethodInvoker(CachedMethod InMethod)
+	{
+		var methodInfo = InMethod.Method;
+
+		if (!CanCompile(methodInfo))
+			return null;
+
+		var declaringType = methodInfo.DeclaringType!;
+		var parameters = methodInfo.GetParameters();
+
+		var dynamicMethod = new DynamicMethod(
+			$"Invoke_{declaringType.Name}_{methodInfo.Name}",
+			typeof(void),
+			[typeof(CachedMethod), typeof(object), typeof(IntPtr), typeof(IntPtr)],
+			typeof(InvokerBuilder).Module,
+			skipVisibility: true);
+
+		var il = dynamicMethod.GetILGenerator();
+
+		if (!methodInfo.IsStatic)
+			EmitLoadTarget(il, declaringType, 1);
+
+		for (int i = 0; i < parameters.Length; i++)
+			EmitLoadParameter(il, parameters[i].ParameterType, i, 2);
+
+		if (methodInfo.IsStatic || declaringType.IsValueType)
+			il.Emit(OpCodes.Call, methodInfo);
+		else
+			il.Emit(OpCodes.Callvirt, methodInfo);
+
+		var returnType = methodInfo.ReturnType;
+
+		if (returnType != typeof(void))
+		{
+			var result = il.DeclareLocal(returnType);
+			var end = il.DefineLabel();
+
+			il.Emit(OpCodes.Stloc, result);
+			il.Emit(OpCodes.Ldarg_3);
+			il.Emit(OpCodes.Brfalse, end);
+			EmitStoreReturnValue(il, returnType, result);
+			il.MarkLabel(end);
+		}
+
+		il.Emit(OpCodes.Ret);
+
+		return (MethodInvoker)dynamicMethod.CreateDelegate(typeof(MethodInvoker), InMethod);
+	}
+
+	// Returns null if the field type can't be written directly, GetValue then falls back to reflection.
+	internal static MemberGetter? BuildFieldGetter(FieldInfo InField)
+	{
+		var declaringType = InField.DeclaringType;
+
+		if (InField.IsStatic || declaringType == null || declaringType.ContainsGenericParameters || !CanStoreValue(InField.FieldType))
+			return null;
+
+		var dynamicMethod = new DynamicMethod($"Get_{declaringType.Name}_{InField.Name}", typeof(void), [typeof(object), typeof(IntPtr)], typeof(InvokerBuilder).Module, skipVisibility: true);
+		var il = dynamicMethod.GetILGenerator();
+
+		il.Emit(OpCodes.Ldarg_1);
+		EmitLoadTarget(il, declaringType, 0);
+		il.Emit(OpCodes.Ldfld, InField);
+		EmitStoreValue(il, InField.FieldType);
+		il.Emit(OpCodes.Ret);
+
+		return dynamicMethod.CreateDelegate<MemberGetter>();
+	}
+
+	internal static MemberSetter? BuildFieldSetter(FieldInfo InField)
+	{
+		var declaringType = InField.DeclaringType;
+
+		if (InField.IsStatic || InField.IsLiteral || declaringType == null || declaringType.ContainsGenericParameters)
+			return null;
+
+		var dynamicMethod = new DynamicMethod($"Set_{declaringType.Name}_{InField.Name}", typeof(void), [typeof(object), typeof(IntPtr)], typeof(InvokerBuilder).Module, skipVisibility: true);
+		var il = dynamicMethod.GetILGenerator();
+
+		EmitLoadTarget(il, declaringType, 0);
+		il.Emit(OpCodes.Ldarg_1);
+		EmitLoadValue(il, InField.FieldType);
+		il.Emit(OpCodes.Stfld, InField);
+		il.Emit(OpCodes.Ret);
+
+		return dynamicMethod.CreateDelegate<MemberSetter>();
+	}
+
+	// Emits a call to an instance accessor method, using callvirt for reference types so overridden properties dispatch correctly
+	private static void EmitCallAccessor(ILGenerator InIL, Type InDeclaringType, MethodInfo InAccessor)
+	{
+		InIL.Emit(InDeclaringType.IsValueType ? OpCodes.Call : OpCodes.Callvirt, InAccessor);
+	}
+
+	private static bool CanCompileProperty(PropertyInfo InProperty, MethodInfo? InAccessor)
+	{
+		var declaringType = InProperty.DeclaringType;
+		return InAccessor != null && !InAccessor.IsStatic && declaringType != null && !declaringType.ContainsGenericParameters && InProperty.GetIndexParameters().Length == 0;
+	}
+
+	// Returns null if the property type can't be written directly, GetValue then falls back to reflection.
+	internal static MemberGetter? BuildPropertyGetter(PropertyInfo InProperty)
+	{
+		var getter = InProperty.GetGetMethod(true);
+
+		if (!CanCompileProperty(InProperty, getter) || !CanStoreValue(InProperty.PropertyType))
+			return null;
+
+		var declaringType = InProperty.DeclaringType!;
+		var dynamicMethod = new DynamicMethod($"Get_{declaringType.Name}_{InProperty.Name}", typeof(void), [typeof(object), typeof(IntPtr)], typeof(InvokerBuilder).Module, skipVisibility: true);
+		var il = dynamicMethod.GetILGenerator();
+
+		il.Emit(OpCodes.Ldarg_1);
+		EmitLoadTarget(il, declaringType, 0);
+		EmitCallAccessor(il, declaringType, getter!);
+		EmitStoreValue(il, InProperty.PropertyType);
+		il.Emit(OpCodes.Ret);
+
+		return dynamicMethod.CreateDelegate<MemberGetter>();
+	}
+
+	internal static MemberSetter? BuildPropertySetter(PropertyInfo InProperty)
+	{
+		var setter = InProperty.GetSetMethod(true);
+
+		if (!CanCompileProperty(InProperty, setter))
+			return null;
+
+		var declaringType = InProperty.DeclaringType!;
+		var dynamicMethod = new DynamicMethod($"Set_{declaringType.Name}_{InProperty.Name}", typeof(void), [typeof(object), typeof(IntPtr)], typeof(InvokerBuilder).Module, skipVisibility: true);
+		var il = dynamicMethod.GetILGenerator();
+
+		EmitLoadTarget(il, declaringType, 0);
+		il.Emit(OpCodes.Ldarg_1);
+		EmitLoadValue(il, InProperty.PropertyType);
+		EmitCallAccessor(il, declaringType, setter!);
+		il.Emit(OpCodes.Ret);
+
+		return dynamicMethod.CreateDelegate<MemberSetter>();
+	}
+
+	// Returns null for constructors that have to be called through reflection, e.g constructors declared on a base type.
+	internal static ObjectFactory? BuildObjectFactory(Type InType, ConstructorInfo InConstructor)
+	{
+		if (InConstructor.DeclaringType != InType || InType.IsAbstract || InType.ContainsGenericParameters)
+			return null;
+
+		var parameters = InConstructor.GetParameters();
+
+		foreach (var parameter in parameters)
+		{
+			if (parameter.ParameterType.IsByRef)
+				return null;
+		}
+
+		var dynamicMethod = new DynamicMethod($"New_{InType.Name}", typeof(object), [typeof(IntPtr)], typeof(InvokerBuilder).Module, skipVisibility: true);
+		var il = dynamicMethod.GetILGenerator();
+
+		for (int i = 0; i < parameters.Length; i++)
+			EmitLoadParameter(il, parameters[i].ParameterType, i, 0);
+
+		il.Emit(OpCodes.Newobj, InConstructor);
+
+		if (InType.IsValueType)
+			il.Emit(OpCodes.Box, InType);
+
+		il.Emit(OpCodes.Ret);
+
+		return dynamicMethod.CreateDelegate<ObjectFactory>();
+	}
+}
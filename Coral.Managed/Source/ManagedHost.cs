@@ -16,10 +16,11 @@ internal static class ManagedHost
 	private static unsafe delegate*<NativeString, MessageLevel, void> s_MessageCallback;
 
 	[UnmanagedCallersOnly]
-	private static unsafe void Initialize(delegate*<NativeString, MessageLevel, void> InMessageCallback, delegate*<NativeString, void> InExceptionCallback)
+	private static unsafe void Initialize(delegate*<NativeString, MessageLevel, void> InMessageCallback, delegate*<NativeString, void> InExceptionCallback, Bool32 InUseObjectHandleTable)
 	{
 		s_MessageCallback = InMessageCallback;
 		s_ExceptionCallback = InExceptionCallback;
+		ObjectHandleTable.s_Enabled = InUseObjectHandleTable;
 	}
 
 	internal static void LogMessage(string InMessage, MessageLevel InLevel)
@@ -1,6 +1,7 @@
 ﻿using Coral.Managed.Interop;
 
 using System;
+using System.Collections.Concurrent;
 using System.Collections.Generic;
 using System.Diagnostics;
 using System.Diagnostics.CodeAnalysis;
@@ -37,56 +38,64 @@ internal enum ManagedType
 internal static class ManagedObject
 {
 
+	// Methods are cached per runtime type, so an override on a subclass gets its own entry and resolves in a single probe.
+	// All entries with the same TypeHandle together form that type's table of resolved methods and overrides. They share one
+	// dictionary instead of one per type, which would take a second probe to find the type's table on every call.
+	// Names are keyed by their NameTable ID, so a probe never hashes or compares a string.
+	// Parameter types are packed 5 bits each after a 4 bit count, signatures that don't fit keep their types in ExtraTypes.
+	// Constructors use the same key with the name ".ctor", so looking one up doesn't allocate either.
 	public readonly struct MethodKey : IEquatable<MethodKey>
 	{
-		public readonly string TypeName;
-		public readonly string Name;
-		public readonly ManagedType[] Types;
-		public readonly int ParameterCount;
+		public const int MaxPackedParameters = 12;
 
-		public MethodKey(string InTypeName, string InName, ManagedType[] InTypes, int InParameterCount)
-		{
-			TypeName = InTypeName;
-			Name = InName;
-			Types = InTypes;
-			ParameterCount = InParameterCount;
-		}
-
-		public override bool Equals([NotNullWhen(true)] object? obj) => obj is MethodKey other && Equals(other);
+		public readonly IntPtr TypeHandle;
+		public readonly int NameId;
+		public readonly ulong Signature;
+		public readonly BindingFlags Flags;
+		public readonly ManagedType[]? ExtraTypes;
 
-		bool IEquatable<MethodKey>.Equals(MethodKey other)
+		public unsafe MethodKey(Type InType, int InNameId, ManagedType* InTypes, int InParameterCount, BindingFlags InFlags)
 		{
-			if (TypeName != other.TypeName || Name != other.Name)
-				return false;
+			TypeHandle = InType.TypeHandle.Value;
+			NameId = InNameId;
+			Flags = InFlags;
+			ExtraTypes = null;
 
-			for (int i = 0; i < Types.Length; i++)
+			if (InParameterCount > MaxPackedParameters)
 			{
-				if (Types[i] != other.Types[i])
-					return false;
+				Signature = ulong.MaxValue;
+				ExtraTypes = new ReadOnlySpan<ManagedType>(InTypes, InParameterCount).ToArray();
+				return;
 			}
 
-			return ParameterCount == other.ParameterCount;
+			ulong signature = (ulong)InParameterCount;
+			for (int i = 0; i < InParameterCount; i++)
+				signature |= ((ulong)InTypes[i] & 0x1F) << (4 + i * 5);
+
+			Signature = signature;
 		}
 
-		public override int GetHashCode()
-		{
-			// NOTE(Peter): Josh Bloch's Hash (from https://stackoverflow.com/questions/263400/what-is-the-best-algorithm-for-overriding-gethashcode)
-			unchecked
-			{
-				int hash = 17;
+		public override bool Equals([NotNullWhen(true)] object? obj) => obj is MethodKey other && Equals(other);
 
-				hash = hash * 23 + TypeName.GetHashCode();
-				hash = hash * 23 + Name.GetHashCode();
-				foreach (var type in Types)
-					hash = hash * 23 + type.GetHashCode();
-				hash = hash * 23 + ParameterCount.GetHashCode();
+		bool IEquatable<MethodKey>.Equals(MethodKey other)
+		{
+			if (TypeHandle != other.TypeHandle || NameId != other.NameId || Signature != other.Signature || Flags != other.Flags)
+				return false;
 
-				return hash;
-			}
+			return ExtraTypes == null ? other.ExtraTypes == null : other.ExtraTypes != null && ExtraTypes.AsSpan().SequenceEqual(other.ExtraTypes);
 		}
+
+		public override int GetHashCode() => HashCode.Combine(TypeHandle, NameId, Signature, Flags);
 	}
 
-	internal static Dictionary<MethodKey, MethodInfo> s_CachedMethods = new Dictionary<MethodKey, MethodInfo>();
+	// Hits are lock-free reads so native code can call in from any number of threads.
+	// Misses resolve under s_ResolveLock so every member is only resolved (and its invoker compiled) once.
+	internal static readonly ConcurrentDictionary<MethodKey, CachedMethod> s_CachedMethods = new();
+	internal static readonly ConcurrentDictionary<MethodKey, CachedConstructor> s_CachedConstructors = new();
+	internal static readonly ConcurrentDictionary<(Type, string), CachedField> s_CachedFields = new();
+	internal static readonly ConcurrentDictionary<(Type, string), CachedProperty> s_CachedProperties = new();
+	private static readonly object s_ResolveLock = new();
+	private static readonly int s_ConstructorNameId = NameTable.Intern(".ctor");
 
 	static string TypeNameOrNull(Type? InType) {
 		if (InType != null) {
@@ -103,191 +112,809 @@ internal static class ManagedObject
 		return ret != null ? ret : "<null>";
 	}
 
+	private static unsafe CachedConstructor? TryGetConstructor(Type InType, ManagedType* InParameterTypes, int InParameterCount)
+	{
+		var constructorKey = new MethodKey(InType, s_ConstructorNameId, InParameterTypes, InParameterCount, BindingFlags.Default);
+
+		if (s_CachedConstructors.TryGetValue(constructorKey, out var cachedConstructor))
+			return cachedConstructor;
+
+		lock (s_ResolveLock)
+		{
+			if (s_CachedConstructors.TryGetValue(constructorKey, out cachedConstructor))
+				return cachedConstructor;
+
+			ConstructorInfo? constructor = null;
+
+			var currentType = InType;
+			while (currentType != null)
+			{
+				constructor = TypeInterface.GetConstructorIndex(currentType).FindSuitableMethod(".ctor", InParameterTypes, InParameterCount);
+
+				if (constructor != null)
+					break;
+
+				currentType = currentType.BaseType;
+			}
+
+			if (constructor == null)
+			{
+				LogMessage($"Failed to find constructor for type {TypeNameOrNull(InType)} with {InParameterCount} parameters.", MessageLevel.Error);
+				return null;
+			}
+
+			cachedConstructor = new CachedConstructor(InType, constructor);
+			s_CachedConstructors.TryAdd(constructorKey, cachedConstructor);
+			return cachedConstructor;
+		}
+	}
+
+	private static IntPtr AllocateObjectHandle(Type InType, object? InObject, bool InWeakRef)
+	{
+		// Native code expects a null handle for objects that failed to construct
+		if (InObject == null)
+		{
+			LogMessage($"Failed to instantiate type {TypeNameOrNull(InType)}.", MessageLevel.Error);
+			return IntPtr.Zero;
+		}
+
+		return ObjectHandleTable.Allocate(InObject, InWeakRef);
+	}
+
 	[UnmanagedCallersOnly]
 	internal static unsafe IntPtr CreateObject(int InTypeID, Bool32 InWeakRef, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount)
 	{
 		try
 		{
-			if (!TypeInterface.s_CachedTypes.TryGetValue(InTypeID, out var type))
+			if (!TypeInterface.s_CachedTypes.TryGetValue(InTypeID, out var type) || type == null)
 			{
 				LogMessage($"Failed to find type with id '{InTypeID}'.", MessageLevel.Error);
 				return IntPtr.Zero;
 			}
 
-			ConstructorInfo? constructor = null;
+			var constructor = TryGetConstructor(type, InParameterTypes, InParameterCount);
 
-			var currentType = type;
-			while (currentType != null)
+			if (constructor == null)
+				return IntPtr.Zero;
+
+			return AllocateObjectHandle(type, constructor.Create(InParameters, InParameterCount), InWeakRef);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return IntPtr.Zero;
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static unsafe void CreateObjects(int InTypeID, Bool32 InWeakRef, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount, IntPtr OutObjects, int InObjectStride, int InObjectCount)
+	{
+		try
+		{
+			if (!TypeInterface.s_CachedTypes.TryGetValue(InTypeID, out var type) || type == null)
 			{
-				ReadOnlySpan<ConstructorInfo> constructors = currentType.GetConstructors(BindingFlags.NonPublic | BindingFlags.Public | BindingFlags.Instance);
-				
-				constructor = TypeInterface.FindSuitableMethod(".ctor", InParameterTypes, InParameterCount, constructors);
+				LogMessage($"Failed to find type with id '{InTypeID}'.", MessageLevel.Error);
+				return;
+			}
 
-				if (constructor != null)
-					break;
+			var constructor = TryGetConstructor(type, InParameterTypes, InParameterCount);
+
+			if (constructor == null)
+				return;
+
+			// The object handle is the first member of Coral::ManagedObject
+			for (int i = 0; i < InObjectCount; i++)
+				Marshal.WriteIntPtr(OutObjects, i * InObjectStride, AllocateObjectHandle(type, constructor.Create(InParameters, InParameterCount), InWeakRef));
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static unsafe int ResolveConstructor(int InTypeID, ManagedType* InParameterTypes, int InParameterCount)
+	{
+		try
+		{
+			if (!TypeInterface.s_CachedTypes.TryGetValue(InTypeID, out var type) || type == null)
+			{
+				LogMessage($"Failed to find type with id '{InTypeID}'.", MessageLevel.Error);
+				return -1;
+			}
+
+			var constructor = TryGetConstructor(type, InParameterTypes, InParameterCount);
+			return constructor != null ? constructor.GetOrCreateHandle() : -1;
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return -1;
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static IntPtr CreateObjectFromConstructor(int InConstructorHandle, Bool32 InWeakRef, IntPtr InParameters, int InParameterCount)
+	{
+		try
+		{
+			if (!CachedConstructor.s_Handles.TryGetValue(InConstructorHandle, out var constructor) || constructor == null)
+			{
+				LogMessage($"Invalid constructor handle '{InConstructorHandle}'. Handles are invalidated when an AssemblyLoadContext is unloaded.", MessageLevel.Error);
+				return IntPtr.Zero;
+			}
+
+			if (constructor.ParameterCount != InParameterCount)
+			{
+				LogMessage($"Constructor '{constructor.Constructor}' expects {constructor.ParameterCount} parameters but was invoked with {InParameterCount}.", MessageLevel.Error);
+				return IntPtr.Zero;
+			}
+
+			return AllocateObjectHandle(constructor.Type, constructor.Create(InParameters, InParameterCount), InWeakRef);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return IntPtr.Zero;
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static IntPtr CreateWeakReference(IntPtr InObjectHandle)
+	{
+		try
+		{
+			var target = ObjectHandleTable.Get(InObjectHandle);
+
+			if (target == null)
+				return IntPtr.Zero;
+
+			return ObjectHandleTable.Allocate(target, true);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return IntPtr.Zero;
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static IntPtr LockWeakReference(IntPtr InWeakHandle)
+	{
+		try
+		{
+			var target = ObjectHandleTable.Get(InWeakHandle);
+
+			if (target == null)
+				return IntPtr.Zero;
+
+			return ObjectHandleTable.Allocate(target);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return IntPtr.Zero;
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static Bool32 IsWeakReferenceAlive(IntPtr InWeakHandle)
+	{
+		try
+		{
+			return ObjectHandleTable.Get(InWeakHandle) != null;
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return false;
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void DestroyObject(IntPtr InObjectHandle)
+	{
+		try
+		{
+			ObjectHandleTable.Free(InObjectHandle);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void DestroyObjects(IntPtr InObjects, int InObjectStride, int InObjectCount)
+	{
+		for (int i = 0; i < InObjectCount; i++)
+		{
+			try
+			{
+				// The object handle is the first member of Coral::ManagedObject, null handles are skipped
+				var objectHandle = Marshal.ReadIntPtr(InObjects, i * InObjectStride);
+
+				if (objectHandle != IntPtr.Zero)
+					ObjectHandleTable.Free(objectHandle);
+			}
+			catch (Exception ex)
+			{
+				HandleException(ex);
+			}
+		}
+	}
+
+	private static unsafe CachedMethod? TryGetMethod(Type InType, string? InMethodName, ManagedType* InParameterTypes, int InParameterCount, BindingFlags InBindingFlags)
+	{
+		if (InMethodName == null) return null;
+
+		return TryGetMethod(InType, NameTable.Intern(InMethodName), InMethodName, InParameterTypes, InParameterCount, InBindingFlags);
+	}
+
+	// Callers that already have the name's ID (the NameId entry points) skip interning the name
+	private static unsafe CachedMethod? TryGetMethod(Type InType, int InNameId, string InMethodName, ManagedType* InParameterTypes, int InParameterCount, BindingFlags InBindingFlags)
+	{
+		var methodKey = new MethodKey(InType, InNameId, InParameterTypes, InParameterCount, InBindingFlags);
+
+		if (s_CachedMethods.TryGetValue(methodKey, out var method))
+			return method;
+
+		lock (s_ResolveLock)
+		{
+			if (s_CachedMethods.TryGetValue(methodKey, out method))
+				return method;
+
+			var methodInfo = TypeInterface.GetMethodIndex(InType, InBindingFlags).FindSuitableMethod(InMethodName, InParameterTypes, InParameterCount);
+
+			if (methodInfo == null)
+			{
+				LogMessage($"Failed to find method '{InMethodName}' for type {InType.FullName} with {InParameterCount} parameters.", MessageLevel.Error);
+				return null;
+			}
+
+			method = CachedMethod.GetOrCreate(methodInfo);
+			s_CachedMethods.TryAdd(methodKey, method);
+			return method;
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static unsafe int ResolveMethod(int InType, NativeString InMethodName, ManagedType* InParameterTypes, int InParameterCount)
+	{
+		try
+		{
+			if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type == null)
+			{
+				LogMessage($"Cannot resolve method {NativeStringOrNull(InMethodName)} on a null type.", MessageLevel.Error);
+				return -1;
+			}
+
+			var method = TryGetMethod(type, InMethodName, InParameterTypes, InParameterCount, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance | BindingFlags.Static);
+
+			if (method == null)
+			{
+				LogMessage($"Failed to resolve method {NativeStringOrNull(InMethodName)}.", MessageLevel.Error);
+				return -1;
+			}
+
+			return method.GetOrCreateHandle();
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return -1;
+		}
+	}
+
+	private static CachedMethod? GetMethodFromHandle(int InMethodHandle, int InParameterCount)
+	{
+		if (!CachedMethod.s_Handles.TryGetValue(InMethodHandle, out var method) || method == null)
+		{
+			LogMessage($"Invalid method handle '{InMethodHandle}'. Handles are invalidated when an AssemblyLoadContext is unloaded.", MessageLevel.Error);
+			return null;
+		}
+
+		if (method.ParameterCount != InParameterCount)
+		{
+			LogMessage($"Method '{method.Method}' expects {method.ParameterCount} parameters but was invoked with {InParameterCount}.", MessageLevel.Error);
+			return null;
+		}
+
+		return method;
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void InvokeMethodHandle(IntPtr InObjectHandle, int InMethodHandle, IntPtr InParameters, int InParameterCount, IntPtr InResultStorage)
+	{
+		try
+		{
+			var method = GetMethodFromHandle(InMethodHandle, InParameterCount);
+
+			if (method == null)
+				return;
+
+			var target = ObjectHandleTable.Get(InObjectHandle);
+
+			if (target == null)
+				return;
+
+			method.Invoke(target, InParameters, InParameterCount, InResultStorage);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void InvokeStaticMethodHandle(int InMethodHandle, IntPtr InParameters, int InParameterCount, IntPtr InResultStorage)
+	{
+		try
+		{
+			var method = GetMethodFromHandle(InMethodHandle, InParameterCount);
+
+			if (method == null)
+				return;
+
+			if (!method.Method.IsStatic)
+			{
+				LogMessage($"Cannot invoke instance method {method.Method.Name} without a target.", MessageLevel.Error);
+				return;
+			}
+
+			method.Invoke(null, InParameters, InParameterCount, InResultStorage);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void InvokeMethodHandleBatch(IntPtr InObjects, int InObjectStride, int InObjectCount, int InMethodHandle, IntPtr InParameters, int InParameterCount, IntPtr InResults, int InResultStride)
+	{
+		try
+		{
+			var method = GetMethodFromHandle(InMethodHandle, InParameterCount);
+
+			if (method == null)
+				return;
+
+			for (int i = 0; i < InObjectCount; i++)
+			{
+				// The object handle is the first member of Coral::ManagedObject
+				var objectHandle = Marshal.ReadIntPtr(InObjects, i * InObjectStride);
+				var target = ObjectHandleTable.Get(objectHandle);
+
+				if (target == null)
+					continue;
+
+				var resultStorage = InResults != IntPtr.Zero ? InResults + i * InResultStride : IntPtr.Zero;
+				method.Invoke(target, InParameters, InParameterCount, resultStorage);
+			}
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static unsafe void InvokeStaticMethod(int InType, NativeString InMethodName, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount)
+	{
+		try
+		{
+			if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type == null)
+			{
+				LogMessage($"Cannot invoke method {NativeStringOrNull(InMethodName)} on a null type.", MessageLevel.Error);
+				return;
+			}
+			
+			var method = TryGetMethod(type, InMethodName, InParameterTypes, InParameterCount, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Static);
+
+			if (method == null)
+			{
+				LogMessage($"Failed to get method info for {NativeStringOrNull(InMethodName)}.", MessageLevel.Error);
+				return;
+			}
+
+			method.Invoke(null, InParameters, InParameterCount, IntPtr.Zero);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static unsafe void InvokeStaticMethodRet(int InType, NativeString InMethodName, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount, IntPtr InResultStorage)
+	{
+		try
+		{
+			if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type == null)
+			{
+				LogMessage($"Cannot invoke method {NativeStringOrNull(InMethodName)} on a null type.", MessageLevel.Error);
+				return;
+			}
+
+			var method = TryGetMethod(type, InMethodName, InParameterTypes, InParameterCount, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Static);
+
+			if (method == null)
+			{
+				LogMessage($"Failed to get method info for {NativeStringOrNull(InMethodName)}.", MessageLevel.Error);
+				return;
+			}
+
+			method.Invoke(null, InParameters, InParameterCount, InResultStorage);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static unsafe void InvokeMethod(IntPtr InObjectHandle, NativeString InMethodName, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount)
+	{
+		try
+		{
+			var target = ObjectHandleTable.Get(InObjectHandle);
+
+			if (target == null)
+			{
+				LogMessage($"Cannot invoke method {NativeStringOrNull(InMethodName)} on a null type.", MessageLevel.Error);
+				return;
+			}
+
+			var targetType = target.GetType();
+
+			var method = TryGetMethod(targetType, InMethodName, InParameterTypes, InParameterCount, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
+
+			if (method == null)
+			{
+				LogMessage($"Failed to get method info for {NativeStringOrNull(InMethodName)}.", MessageLevel.Error);
+				return;
+			}
+
+			method.Invoke(target, InParameters, InParameterCount, IntPtr.Zero);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+	
+	[UnmanagedCallersOnly]
+	internal static unsafe void InvokeMethodRet(IntPtr InObjectHandle, NativeString InMethodName, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount, IntPtr InResultStorage)
+	{
+		try
+		{
+			var target = ObjectHandleTable.Get(InObjectHandle);
+
+			if (target == null)
+				return;
+
+			var targetType = target.GetType();
+
+			var method = TryGetMethod(targetType, InMethodName, InParameterTypes, InParameterCount, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
+
+			if (method == null)
+			{
+				LogMessage($"Failed to get method info for {NativeStringOrNull(InMethodName)}.", MessageLevel.Error);
+				return;
+			}
+
+			method.Invoke(target, InParameters, InParameterCount, InResultStorage);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static int ResolveFieldAccessor(int InType, NativeString InFieldName)
+	{
+		try
+		{
+			if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type == null)
+			{
+				LogMessage($"Cannot resolve field {NativeStringOrNull(InFieldName)} on a null type.", MessageLevel.Error);
+				return -1;
+			}
+
+			string? fieldName = InFieldName;
+
+			if (fieldName == null)
+				return -1;
+
+			return TryGetField(type, fieldName)?.Handle ?? -1;
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return -1;
+		}
+	}
+
+	private static CachedField? TryGetField(Type InType, string InFieldName)
+	{
+		if (s_CachedFields.TryGetValue((InType, InFieldName), out var field))
+			return field;
+
+		lock (s_ResolveLock)
+		{
+			if (s_CachedFields.TryGetValue((InType, InFieldName), out field))
+				return field;
+
+			var fieldInfo = InType.GetField(InFieldName, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
+
+			if (fieldInfo == null)
+			{
+				LogMessage($"Failed to find field '{InFieldName}' in type '{InType.FullName}'.", MessageLevel.Error);
+				return null;
+			}
+
+			field = new CachedField(fieldInfo);
+			s_CachedFields.TryAdd((InType, InFieldName), field);
+			return field;
+		}
+	}
+
+	private static CachedField? GetFieldFromHandle(int InFieldHandle)
+	{
+		if (!CachedField.s_Handles.TryGetValue(InFieldHandle, out var field) || field == null)
+		{
+			LogMessage($"Invalid field accessor '{InFieldHandle}'. Accessors are invalidated when an AssemblyLoadContext is unloaded.", MessageLevel.Error);
+			return null;
+		}
+
+		return field;
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void SetFieldAccessorValue(IntPtr InTarget, int InFieldHandle, IntPtr InValue)
+	{
+		try
+		{
+			var field = GetFieldFromHandle(InFieldHandle);
+
+			if (field == null)
+				return;
+
+			var target = ObjectHandleTable.Get(InTarget);
+
+			if (target == null)
+				return;
+
+			field.SetValue(target, InValue);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void GetFieldAccessorValue(IntPtr InTarget, int InFieldHandle, IntPtr OutValue)
+	{
+		try
+		{
+			var field = GetFieldFromHandle(InFieldHandle);
+
+			if (field == null)
+				return;
+
+			var target = ObjectHandleTable.Get(InTarget);
+
+			if (target == null)
+				return;
+
+			field.GetValue(target, OutValue);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void SetFieldValue(IntPtr InTarget, NativeString InFieldName, IntPtr InValue)
+	{
+		try
+		{
+			var target = ObjectHandleTable.Get(InTarget);
 
-				currentType = currentType.BaseType;
-			}
+			if (target == null)
+				return;
 
-			if (constructor == null)
+			var targetType = target.GetType();
+			var fieldInfo = targetType.GetField(InFieldName!, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
+
+			if (fieldInfo == null)
 			{
-				LogMessage($"Failed to find constructor for type {TypeNameOrNull(type)} with {InParameterCount} parameters.", MessageLevel.Error);
-				return IntPtr.Zero;
+				LogMessage($"Failed to find field '{InFieldName}' in type '{targetType.FullName}'.", MessageLevel.Error);
+				return;
 			}
 
-			var parameters = Marshalling.MarshalParameterArray(InParameters, InParameterCount, constructor);
+			if (fieldInfo.FieldType == typeof(string))
+			{
+				object? fieldValue = Marshalling.MarshalPointer(InValue, typeof(NativeString));
 
-			object? result = null;
+				if (fieldValue == null)
+				{
+					LogMessage($"Failed to get field '{InFieldName}' value in type '{targetType.FullName}'.", MessageLevel.Error);
+					return;
+				}
 
-			if (type == null)
-			{
-				LogMessage($"Failed to instantiate type {TypeNameOrNull(type)}.", MessageLevel.Error);
-				return IntPtr.Zero;
+				NativeString value = (NativeString) fieldValue;
+				fieldInfo.SetValue(target, value.ToString());
 			}
-
-			if (currentType != type || parameters == null)
+			else if (fieldInfo.FieldType == typeof(bool))
 			{
-				result = TypeInterface.CreateInstance(type);
+				object? fieldValue = Marshalling.MarshalPointer(InValue, typeof(Bool32));
+
+				if (fieldValue == null)
+				{
+					LogMessage($"Failed to get field '{InFieldName}' value in type '{targetType.FullName}'.", MessageLevel.Error);
+					return;
+				}
 
-				if (currentType != type)
-					constructor.Invoke(result, parameters);
+				Bool32 value = (Bool32) fieldValue;
+				fieldInfo.SetValue(target, (bool) value);
 			}
 			else
 			{
-				result = TypeInterface.CreateInstance(type, parameters);
-			}
+				object? value = Marshalling.MarshalPointer(InValue, fieldInfo.FieldType);
 
-			if (result == null)
-			{
-				LogMessage($"Failed to instantiate type {TypeNameOrNull(type)}.", MessageLevel.Error);
+				fieldInfo.SetValue(target, value);
 			}
-
-			var handle = GCHandle.Alloc(result, InWeakRef ? GCHandleType.Weak : GCHandleType.Normal);
-#if DEBUG
-			AssemblyLoader.RegisterHandle(type.Assembly, handle);
-#endif
-			return GCHandle.ToIntPtr(handle);
 		}
 		catch (Exception ex)
 		{
 			HandleException(ex);
-			return IntPtr.Zero;
 		}
 	}
 
 	[UnmanagedCallersOnly]
-	internal static unsafe IntPtr CopyObject(IntPtr InObjectHandle)
+	internal static void GetFieldValue(IntPtr InTarget, NativeString InFieldName, IntPtr OutValue)
 	{
 		try
 		{
-			var target = GCHandle.FromIntPtr(InObjectHandle).Target;
+			var target = ObjectHandleTable.Get(InTarget);
 
 			if (target == null)
+				return;
+
+			var targetType = target.GetType();
+			var fieldInfo = targetType.GetField(InFieldName!, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
+
+			if (fieldInfo == null)
 			{
-				LogMessage($"Cannot copy object with handle {InObjectHandle}. Target was null.", MessageLevel.Error);
-				return IntPtr.Zero;
+				LogMessage($"Failed to find field '{InFieldName}' in type '{targetType.FullName}'.", MessageLevel.Error);
+				return;
 			}
 
-			var handle = GCHandle.Alloc(target, GCHandleType.Normal);
-#if DEBUG
-			var type = target.GetType();
-			AssemblyLoader.RegisterHandle(type.Assembly, handle);
-#endif
-			return GCHandle.ToIntPtr(handle);
+			// Handles strings gracefully internally.
+			Marshalling.MarshalReturnValue(target, fieldInfo.GetValue(target), fieldInfo, OutValue);
 		}
 		catch (Exception ex)
 		{
 			HandleException(ex);
-			return IntPtr.Zero;
 		}
 	}
 
 	[UnmanagedCallersOnly]
-	internal static void DestroyObject(IntPtr InObjectHandle)
+	internal static int ResolvePropertyAccessor(int InType, NativeString InPropertyName)
 	{
 		try
 		{
-			GCHandle handle = GCHandle.FromIntPtr(InObjectHandle);
-#if DEBUG
-			var type = handle.Target?.GetType();
-			if (type is not null) {
-				AssemblyLoader.DeregisterHandle(type.Assembly, handle);
+			if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type == null)
+			{
+				LogMessage($"Cannot resolve property {NativeStringOrNull(InPropertyName)} on a null type.", MessageLevel.Error);
+				return -1;
 			}
-#endif
-			handle.Free();
+
+			string? propertyName = InPropertyName;
+
+			if (propertyName == null)
+				return -1;
+
+			return TryGetProperty(type, propertyName)?.Handle ?? -1;
 		}
 		catch (Exception ex)
 		{
 			HandleException(ex);
+			return -1;
 		}
 	}
 
-	private static unsafe MethodInfo? TryGetMethodInfo(Type InType, string? InMethodName, ManagedType* InParameterTypes, int InParameterCount, BindingFlags InBindingFlags)
+	private static CachedProperty? TryGetProperty(Type InType, string InPropertyName)
 	{
-		MethodInfo? methodInfo = null;
+		if (s_CachedProperties.TryGetValue((InType, InPropertyName), out var property))
+			return property;
 
-		var parameterTypes = new ManagedType[InParameterCount];
+		lock (s_ResolveLock)
+		{
+			if (s_CachedProperties.TryGetValue((InType, InPropertyName), out property))
+				return property;
 
-		if (InMethodName == null) return null;
+			var propertyInfo = InType.GetProperty(InPropertyName, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
 
-		unsafe
-		{
-			fixed (ManagedType* parameterTypesPtr = parameterTypes)
+			if (propertyInfo == null)
 			{
-				ulong size = sizeof(ManagedType) * (ulong)InParameterCount;
-				Buffer.MemoryCopy(InParameterTypes, parameterTypesPtr, size, size);
+				LogMessage($"Failed to find property '{InPropertyName}' in type '{InType.FullName}'.", MessageLevel.Error);
+				return null;
 			}
+
+			property = new CachedProperty(propertyInfo);
+			s_CachedProperties.TryAdd((InType, InPropertyName), property);
+			return property;
+		}
+	}
+
+	private static CachedProperty? GetPropertyFromHandle(int InPropertyHandle)
+	{
+		if (!CachedProperty.s_Handles.TryGetValue(InPropertyHandle, out var property) || property == null)
+		{
+			LogMessage($"Invalid property accessor '{InPropertyHandle}'. Accessors are invalidated when an AssemblyLoadContext is unloaded.", MessageLevel.Error);
+			return null;
 		}
 
-		var methodKey = new MethodKey(TypeNameOrNull(InType), InMethodName, parameterTypes, InParameterCount);
+		return property;
+	}
 
-		if (!s_CachedMethods.TryGetValue(methodKey, out methodInfo))
+	[UnmanagedCallersOnly]
+	internal static void SetPropertyAccessorValue(IntPtr InTarget, int InPropertyHandle, IntPtr InValue)
+	{
+		try
 		{
-			List<MethodInfo> methods = new(InType.GetMethods(InBindingFlags));
+			var property = GetPropertyFromHandle(InPropertyHandle);
+
+			if (property == null)
+				return;
 
-			Type? baseType = InType.BaseType;
-			while (baseType != null)
+			if (!property.CanWrite)
 			{
-				methods.AddRange(baseType.GetMethods(InBindingFlags));
-				baseType = baseType.BaseType;
+				LogMessage($"Cannot set value of property '{property.Property.Name}'. No setter was found.", MessageLevel.Error);
+				return;
 			}
 
-			methodInfo = TypeInterface.FindSuitableMethod<MethodInfo>(InMethodName, InParameterTypes, InParameterCount, CollectionsMarshal.AsSpan(methods));
+			var target = ObjectHandleTable.Get(InTarget);
 
-			if (methodInfo == null)
-			{
-				LogMessage($"Failed to find method '{InMethodName}' for type {InType.FullName} with {InParameterCount} parameters.", MessageLevel.Error);
-				return null;
-			}
+			if (target == null)
+				return;
 
-			s_CachedMethods.Add(methodKey, methodInfo);
+			property.SetValue(target, InValue);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
 		}
-
-		return methodInfo;
 	}
 
 	[UnmanagedCallersOnly]
-	internal static unsafe void InvokeStaticMethod(int InType, NativeString InMethodName, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount)
+	internal static void GetPropertyAccessorValue(IntPtr InTarget, int InPropertyHandle, IntPtr OutValue)
 	{
 		try
 		{
-			if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type == null)
-			{
-				LogMessage($"Cannot invoke method {NativeStringOrNull(InMethodName)} on a null type.", MessageLevel.Error);
+			var property = GetPropertyFromHandle(InPropertyHandle);
+
+			if (property == null)
 				return;
-			}
-			
-			var methodInfo = TryGetMethodInfo(type, InMethodName, InParameterTypes, InParameterCount, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Static);
 
-			if (methodInfo == null)
+			if (!property.CanRead)
 			{
-				LogMessage($"Failed to get method info for {NativeStringOrNull(InMethodName)}.", MessageLevel.Error);
+				LogMessage($"Cannot get value of property '{property.Property.Name}'. No getter was found.", MessageLevel.Error);
 				return;
 			}
 
-			var parameters = Marshalling.MarshalParameterArray(InParameters, InParameterCount, methodInfo);
+			var target = ObjectHandleTable.Get(InTarget);
+
+			if (target == null)
+				return;
 
-			methodInfo.Invoke(null, parameters);
+			property.GetValue(target, OutValue);
 		}
 		catch (Exception ex)
 		{
@@ -296,32 +923,32 @@ internal static class ManagedObject
 	}
 
 	[UnmanagedCallersOnly]
-	internal static unsafe void InvokeStaticMethodRet(int InType, NativeString InMethodName, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount, IntPtr InResultStorage)
+	internal static void SetPropertyValue(IntPtr InTarget, NativeString InPropertyName, IntPtr InValue)
 	{
 		try
 		{
-			if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type == null)
-			{
-				LogMessage($"Cannot invoke method {NativeStringOrNull(InMethodName)} on a null type.", MessageLevel.Error);
-				return;
-			}
+			var target = ObjectHandleTable.Get(InTarget);
 
-			var methodInfo = TryGetMethodInfo(type, InMethodName, InParameterTypes, InParameterCount, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Static);
+			if (target == null)
+				return;
 
-			if (methodInfo == null)
+			var targetType = target.GetType();
+			var propertyInfo = targetType.GetProperty(InPropertyName!, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
+		
+			if (propertyInfo == null)
 			{
-				LogMessage($"Failed to get method info for {NativeStringOrNull(InMethodName)}.", MessageLevel.Error);
+				LogMessage($"Failed to find property '{InPropertyName}' in type '{targetType.FullName}'", MessageLevel.Error);
 				return;
 			}
 
-			var methodParameters = Marshalling.MarshalParameterArray(InParameters, InParameterCount, methodInfo);
-
-			object? value = methodInfo.Invoke(null, methodParameters);
-
-			if (value == null)
+			if (propertyInfo.SetMethod == null)
+			{
+				LogMessage($"Cannot set value of property '{InPropertyName}'. No setter was found.", MessageLevel.Error);
 				return;
+			}
 
-			Marshalling.MarshalReturnValue(null, value, methodInfo, InResultStorage);
+			object? value = Marshalling.MarshalPointer(InValue, propertyInfo.PropertyType);
+			propertyInfo.SetValue(target, value);
 		}
 		catch (Exception ex)
 		{
@@ -330,69 +957,62 @@ internal static class ManagedObject
 	}
 
 	[UnmanagedCallersOnly]
-	internal static unsafe void InvokeMethod(IntPtr InObjectHandle, NativeString InMethodName, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount)
+	internal static void GetPropertyValue(IntPtr InTarget, NativeString InPropertyName, IntPtr OutValue)
 	{
 		try
 		{
-			var target = GCHandle.FromIntPtr(InObjectHandle).Target;
+			var target = ObjectHandleTable.Get(InTarget);
 
 			if (target == null)
-			{
-				LogMessage($"Cannot invoke method {NativeStringOrNull(InMethodName)} on a null type.", MessageLevel.Error);
 				return;
-			}
 
 			var targetType = target.GetType();
+			var propertyInfo = targetType.GetProperty(InPropertyName!, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
 
-			var methodInfo = TryGetMethodInfo(targetType, InMethodName, InParameterTypes, InParameterCount, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
-
-			if (methodInfo == null)
+			if (propertyInfo == null)
 			{
-				LogMessage($"Failed to get method info for {NativeStringOrNull(InMethodName)}.", MessageLevel.Error);
+				LogMessage($"Failed to find property '{InPropertyName}' in type '{targetType.FullName}'.", MessageLevel.Error);
 				return;
 			}
 
-			var parameters = Marshalling.MarshalParameterArray(InParameters, InParameterCount, methodInfo);
+			if (propertyInfo.GetMethod == null)
+			{
+				LogMessage($"Cannot get value of property '{InPropertyName}'. No getter was found.", MessageLevel.Error);
+				return;
+			}
 
-			methodInfo.Invoke(target, parameters);
+			Marshalling.MarshalReturnValue(target, propertyInfo.GetValue(target), propertyInfo, OutValue);
 		}
 		catch (Exception ex)
 		{
 			HandleException(ex);
 		}
 	}
-	
+
 	[UnmanagedCallersOnly]
-	internal static unsafe void InvokeMethodRet(IntPtr InObjectHandle, NativeString InMethodName, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount, IntPtr InResultStorage)
+	internal static unsafe void InvokeMethodByNameId(IntPtr InObjectHandle, int InNameId, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount, IntPtr InResultStorage)
 	{
 		try
 		{
-			var target = GCHandle.FromIntPtr(InObjectHandle).Target;
+			var methodName = NameTable.GetName(InNameId);
 
-			if (target == null)
-			{
-				LogMessage($"Cannot invoke method {InMethodName} on object with handle {InObjectHandle}. Target was null.", MessageLevel.Error);
+			if (methodName == null)
 				return;
-			}
-
-			var targetType = target.GetType();
 
-			var methodInfo = TryGetMethodInfo(targetType, InMethodName, InParameterTypes, InParameterCount, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
+			var target = ObjectHandleTable.Get(InObjectHandle);
 
-			if (methodInfo == null)
-			{
-				LogMessage($"Failed to get method info for {NativeStringOrNull(InMethodName)}.", MessageLevel.Error);
+			if (target == null)
 				return;
-			}
 
-			var methodParameters = Marshalling.MarshalParameterArray(InParameters, InParameterCount, methodInfo);
-			
-			object? value = methodInfo.Invoke(target, methodParameters);
+			var method = TryGetMethod(target.GetType(), InNameId, methodName, InParameterTypes, InParameterCount, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
 
-			if (value == null)
+			if (method == null)
+			{
+				LogMessage($"Failed to get method info for {methodName}.", MessageLevel.Error);
 				return;
+			}
 
-			Marshalling.MarshalReturnValue(target, value, methodInfo, InResultStorage);
+			method.Invoke(target, InParameters, InParameterCount, InResultStorage);
 		}
 		catch (Exception ex)
 		{
@@ -401,59 +1021,53 @@ internal static class ManagedObject
 	}
 
 	[UnmanagedCallersOnly]
-	internal static void SetFieldValue(IntPtr InTarget, NativeString InFieldName, IntPtr InValue)
+	internal static unsafe void InvokeStaticMethodByNameId(int InType, int InNameId, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount, IntPtr InResultStorage)
 	{
 		try
 		{
-			var target = GCHandle.FromIntPtr(InTarget).Target;
+			var methodName = NameTable.GetName(InNameId);
 
-			if (target == null)
+			if (methodName == null)
+				return;
+
+			if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type == null)
 			{
-				LogMessage($"Cannot set value of field {InFieldName} on object with handle {InTarget}. Target was null.", MessageLevel.Error);
+				LogMessage($"Cannot invoke method {methodName} on a null type.", MessageLevel.Error);
 				return;
 			}
 
-			var targetType = target.GetType();
-			var fieldInfo = targetType.GetField(InFieldName!, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
+			var method = TryGetMethod(type, InNameId, methodName, InParameterTypes, InParameterCount, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Static);
 
-			if (fieldInfo == null)
+			if (method == null)
 			{
-				LogMessage($"Failed to find field '{InFieldName}' in type '{targetType.FullName}'.", MessageLevel.Error);
+				LogMessage($"Failed to get method info for {methodName}.", MessageLevel.Error);
 				return;
 			}
 
-			if (fieldInfo.FieldType == typeof(string))
-			{
-				object? fieldValue = Marshalling.MarshalPointer(InValue, typeof(NativeString));
+			method.Invoke(null, InParameters, InParameterCount, InResultStorage);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
 
-				if (fieldValue == null)
-				{
-					LogMessage($"Failed to get field '{InFieldName}' value in type '{targetType.FullName}'.", MessageLevel.Error);
-					return;
-				}
+	[UnmanagedCallersOnly]
+	internal static void SetFieldValueByNameId(IntPtr InTarget, int InNameId, IntPtr InValue)
+	{
+		try
+		{
+			var fieldName = NameTable.GetName(InNameId);
 
-				NativeString value = (NativeString) fieldValue;
-				fieldInfo.SetValue(target, value.ToString());
-			}
-			else if (fieldInfo.FieldType == typeof(bool))
-			{
-				object? fieldValue = Marshalling.MarshalPointer(InValue, typeof(Bool32));
+			if (fieldName == null)
+				return;
 
-				if (fieldValue == null)
-				{
-					LogMessage($"Failed to get field '{InFieldName}' value in type '{targetType.FullName}'.", MessageLevel.Error);
-					return;
-				}
+			var target = ObjectHandleTable.Get(InTarget);
 
-				Bool32 value = (Bool32) fieldValue;
-				fieldInfo.SetValue(target, (bool) value);
-			}
-			else
-			{
-				object? value = Marshalling.MarshalPointer(InValue, fieldInfo.FieldType);
+			if (target == null)
+				return;
 
-				fieldInfo.SetValue(target, value);
-			}
+			TryGetField(target.GetType(), fieldName)?.SetValue(target, InValue);
 		}
 		catch (Exception ex)
 		{
@@ -462,29 +1076,21 @@ internal static class ManagedObject
 	}
 
 	[UnmanagedCallersOnly]
-	internal static void GetFieldValue(IntPtr InTarget, NativeString InFieldName, IntPtr OutValue)
+	internal static void GetFieldValueByNameId(IntPtr InTarget, int InNameId, IntPtr OutValue)
 	{
 		try
 		{
-			var target = GCHandle.FromIntPtr(InTarget).Target;
+			var fieldName = NameTable.GetName(InNameId);
 
-			if (target == null)
-			{
-				LogMessage($"Cannot get value of field {InFieldName} from object with handle {InTarget}. Target was null.", MessageLevel.Error);
+			if (fieldName == null)
 				return;
-			}
 
-			var targetType = target.GetType();
-			var fieldInfo = targetType.GetField(InFieldName!, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
+			var target = ObjectHandleTable.Get(InTarget);
 
-			if (fieldInfo == null)
-			{
-				LogMessage($"Failed to find field '{InFieldName}' in type '{targetType.FullName}'.", MessageLevel.Error);
+			if (target == null)
 				return;
-			}
 
-			// Handles strings gracefully internally.
-			Marshalling.MarshalReturnValue(target, fieldInfo.GetValue(target), fieldInfo, OutValue);
+			TryGetField(target.GetType(), fieldName)?.GetValue(target, OutValue);
 		}
 		catch (Exception ex)
 		{
@@ -493,35 +1099,32 @@ internal static class ManagedObject
 	}
 
 	[UnmanagedCallersOnly]
-	internal static void SetPropertyValue(IntPtr InTarget, NativeString InPropertyName, IntPtr InValue)
+	internal static void SetPropertyValueByNameId(IntPtr InTarget, int InNameId, IntPtr InValue)
 	{
 		try
 		{
-			var target = GCHandle.FromIntPtr(InTarget).Target;
+			var propertyName = NameTable.GetName(InNameId);
+
+			if (propertyName == null)
+				return;
+
+			var target = ObjectHandleTable.Get(InTarget);
 
 			if (target == null)
-			{
-				LogMessage($"Cannot set value of property {InPropertyName} on object with handle {InTarget}. Target was null.", MessageLevel.Error);
 				return;
-			}
 
-			var targetType = target.GetType();
-			var propertyInfo = targetType.GetProperty(InPropertyName!, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
-		
-			if (propertyInfo == null)
-			{
-				LogMessage($"Failed to find property '{InPropertyName}' in type '{targetType.FullName}'", MessageLevel.Error);
+			var property = TryGetProperty(target.GetType(), propertyName);
+
+			if (property == null)
 				return;
-			}
 
-			if (propertyInfo.SetMethod == null)
+			if (!property.CanWrite)
 			{
-				LogMessage($"Cannot set value of property '{InPropertyName}'. No setter was found.", MessageLevel.Error);
+				LogMessage($"Cannot set value of property '{propertyName}'. No setter was found.", MessageLevel.Error);
 				return;
 			}
 
-			object? value = Marshalling.MarshalPointer(InValue, propertyInfo.PropertyType);
-			propertyInfo.SetValue(target, value);
+			property.SetValue(target, InValue);
 		}
 		catch (Exception ex)
 		{
@@ -530,34 +1133,32 @@ internal static class ManagedObject
 	}
 
 	[UnmanagedCallersOnly]
-	internal static void GetPropertyValue(IntPtr InTarget, NativeString InPropertyName, IntPtr OutValue)
+	internal static void GetPropertyValueByNameId(IntPtr InTarget, int InNameId, IntPtr OutValue)
 	{
 		try
 		{
-			var target = GCHandle.FromIntPtr(InTarget).Target;
+			var propertyName = NameTable.GetName(InNameId);
+
+			if (propertyName == null)
+				return;
+
+			var target = ObjectHandleTable.Get(InTarget);
 
 			if (target == null)
-			{
-				LogMessage($"Cannot get value of property '{InPropertyName}' from object with handle {InTarget}. Target was null.", MessageLevel.Error);
 				return;
-			}
 
-			var targetType = target.GetType();
-			var propertyInfo = targetType.GetProperty(InPropertyName!, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
+			var property = TryGetProperty(target.GetType(), propertyName);
 
-			if (propertyInfo == null)
-			{
-				LogMessage($"Failed to find property '{InPropertyName}' in type '{targetType.FullName}'.", MessageLevel.Error);
+			if (property == null)
 				return;
-			}
 
-			if (propertyInfo.GetMethod == null)
+			if (!property.CanRead)
 			{
-				LogMessage($"Cannot get value of property '{InPropertyName}'. No getter was found.", MessageLevel.Error);
+				LogMessage($"Cannot get value of property '{propertyName}'. No getter was found.", MessageLevel.Error);
 				return;
 			}
 
-			Marshalling.MarshalReturnValue(target, propertyInfo.GetValue(target), propertyInfo, OutValue);
+			property.GetValue(target, OutValue);
 		}
 		catch (Exception ex)
 		{
@@ -570,13 +1171,10 @@ internal static class ManagedObject
 	{
 		try
 		{
-			var target = GCHandle.FromIntPtr(InTarget).Target;
+			var target = ObjectHandleTable.Get(InTarget);
 
 			if (target == null)
-			{
-				LogMessage($"Cannot get type of object. Target was null.", MessageLevel.Error);
 				return;
-			}
 
 			*typeId = TypeInterface.s_CachedTypes.Add(target.GetType());
 		}
@@ -1,8 +1,10 @@
 ﻿using Coral.Managed.Interop;
 
 using System;
+using System.Collections.Concurrent;
 using System.Linq;
 using System.Reflection;
+using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 
 namespace Coral.Managed;
@@ -29,10 +31,31 @@ public static class Marshalling
 	private struct ArrayObject
 	{
 		public IntPtr Handle;
-		public IntPtr Padding;
+		public IntPtr Type;
+		public IntPtr RefCount;
 	}
 #pragma warning restore 0649
 
+	internal delegate void ValueWriter(object InValue, IntPtr OutValue);
+
+	// Writers for blittable return types, null for types that have to go through the pinning path
+	internal static readonly ConcurrentDictionary<Type, ValueWriter?> s_ValueWriters = new();
+
+	private static readonly MethodInfo s_WriteValueMethod = typeof(Marshalling).GetMethod(nameof(WriteValue), BindingFlags.NonPublic | BindingFlags.Static)!;
+
+	private static unsafe void WriteValue<T>(object InValue, IntPtr OutValue) where T : unmanaged => Unsafe.Write(OutValue.ToPointer(), (T)InValue);
+
+	private static ValueWriter? GetValueWriter(Type InType)
+	{
+		return s_ValueWriters.GetOrAdd(InType, static type =>
+		{
+			if (type.IsPointer || !InvokerBuilder.IsBlittable(type))
+				return null;
+
+			return s_WriteValueMethod.MakeGenericMethod(type).CreateDelegate<ValueWriter>();
+		});
+	}
+
 	public static void MarshalReturnValue(object? InTarget, object? InValue, MemberInfo? InMemberInfo, IntPtr OutValue)
 	{
 		if (InMemberInfo == null)
@@ -96,6 +119,10 @@ public static class Marshalling
 				}
 			}
 		}
+		else if (type != null && InValue != null && GetValueWriter(type) is ValueWriter valueWriter)
+		{
+			valueWriter(InValue, OutValue);
+		}
 		else if (type != null)
 		{
 			int valueSize = type.IsEnum ? Marshal.SizeOf(Enum.GetUnderlyingType(type)) : Marshal.SizeOf(type);
@@ -167,7 +194,7 @@ public static class Marshalling
 				{
 					IntPtr source = (IntPtr)(((byte*)arrayContainer.Data.ToPointer()) + (i * Marshal.SizeOf<ArrayObject>()));
 					var managedObject = MarshalPointer<ArrayObject>(source);
-					var target = GCHandle.FromIntPtr(managedObject.Handle).Target;
+					var target = managedObject.Handle != IntPtr.Zero ? ObjectHandleTable.Get(managedObject.Handle) : null;
 					result.SetValue(target, i);
 				}
 			}
@@ -236,6 +263,9 @@ public static class Marshalling
 			return Marshal.PtrToStructure<NativeString>(InValue);
 		}
 
+		if (InType.IsPrimitive)
+			return MarshalPrimitive(InValue, InType);
+
 		if (InType.IsSZArray)
 			return MarshalArray(InValue, InType.GetElementType());
 
@@ -252,15 +282,35 @@ public static class Marshalling
 
 		if (InType.IsClass)
 		{
-			var handlePtr = Marshal.ReadIntPtr(InValue);
-			var handle = GCHandle.FromIntPtr(handlePtr);
-			return handle.Target;
+			var handle = Marshal.ReadIntPtr(InValue);
+			return handle != IntPtr.Zero ? ObjectHandleTable.Get(handle) : null;
 		}
 
 		return Marshal.PtrToStructure(InValue, InType);	
 	}
 	public static T? MarshalPointer<T>(IntPtr InValue) => Marshal.PtrToStructure<T>(InValue);
 
+	// Reads primitives directly instead of going through Marshal.PtrToStructure, bool is handled by MarshalPointer
+	private static unsafe object MarshalPrimitive(IntPtr InValue, Type InType)
+	{
+		void* value = InValue.ToPointer();
+
+		return Type.GetTypeCode(InType) switch
+		{
+			TypeCode.SByte => Unsafe.Read<sbyte>(value),
+			TypeCode.Byte => Unsafe.Read<byte>(value),
+			TypeCode.Int16 => Unsafe.Read<short>(value),
+			TypeCode.UInt16 => Unsafe.Read<ushort>(value),
+			TypeCode.Int32 => Unsafe.Read<int>(value),
+			TypeCode.UInt32 => Unsafe.Read<uint>(value),
+			TypeCode.Int64 => Unsafe.Read<long>(value),
+			TypeCode.UInt64 => Unsafe.Read<ulong>(value),
+			TypeCode.Single => Unsafe.Read<float>(value),
+			TypeCode.Double => Unsafe.Read<double>(value),
+			_ => Marshal.PtrToStructure(InValue, InType)!
+		};
+	}
+
 	public static IntPtr[] NativeArrayToIntPtrArray(IntPtr InNativeArray, int InLength)
 	{
 		try
@@ -282,6 +332,18 @@ public static class Marshalling
 		}
 	}
 
+	// Parameter types per method, GetParameters() allocates a new array every time it's called
+	internal static readonly ConcurrentDictionary<MethodBase, Type[]> s_ParameterTypes = new();
+
+	internal static Type[] GetParameterTypes(MethodBase InMethodInfo)
+	{
+		return s_ParameterTypes.GetOrAdd(InMethodInfo, static method => Array.ConvertAll(method.GetParameters(), parameter => parameter.ParameterType));
+	}
+
+	// Per-thread pool of argument arrays indexed by length, see RentParameterArray
+	[ThreadStatic]
+	private static object?[]?[]? t_ParameterArrayPool;
+
 	public static object?[]? MarshalParameterArray(IntPtr InNativeArray, int InLength, MethodBase? InMethodInfo)
 	{
 		if (InMethodInfo == null)
@@ -290,16 +352,63 @@ public static class Marshalling
 		if (InNativeArray == IntPtr.Zero || InLength == 0)
 			return null;
 
-		var parameterInfos = InMethodInfo.GetParameters();
-		var parameterPointers = NativeArrayToIntPtrArray(InNativeArray, InLength);
-		var result = new object?[parameterPointers.Length];
+		var result = new object?[InLength];
+		MarshalParameters(InNativeArray, GetParameterTypes(InMethodInfo), result);
+		return result;
+	}
 
-		for (int i = 0; i < parameterPointers.Length; i++)
+	// Same as MarshalParameterArray but reuses argument arrays, the result has to be handed back with ReturnParameterArray once
+	// the call is done. Nested calls on the same thread simply get a fresh array if the pooled one is already in use.
+	internal static object?[]? RentParameterArray(IntPtr InNativeArray, int InLength, MethodBase? InMethodInfo)
+	{
+		if (InMethodInfo == null)
+			return null;
+
+		if (InNativeArray == IntPtr.Zero || InLength == 0)
+			return null;
+
+		var pool = t_ParameterArrayPool;
+		object?[]? result = null;
+
+		if (pool != null && InLength < pool.Length)
 		{
-			result[i] = MarshalPointer(parameterPointers[i], parameterInfos[i].ParameterType);
+			result = pool[InLength];
+			pool[InLength] = null;
 		}
 
+		result ??= new object?[InLength];
+		MarshalParameters(InNativeArray, GetParameterTypes(InMethodInfo), result);
 		return result;
 	}
+
+	internal static void ReturnParameterArray(object?[]? InParameters)
+	{
+		if (InParameters == null)
+			return;
+
+		Array.Clear(InParameters);
+
+		var pool = t_ParameterArrayPool;
+
+		if (pool == null || InParameters.Length >= pool.Length)
+		{
+			var newPool = new object?[]?[Math.Max(InParameters.Length + 1, 16)];
+
+			if (pool != null)
+				Array.Copy(pool, newPool, pool.Length);
+
+			t_ParameterArrayPool = pool = newPool;
+		}
+
+		pool[InParameters.Length] = InParameters;
+	}
+
+	private static unsafe void MarshalParameters(IntPtr InNativeArray, Type[] InParameterTypes, object?[] OutParameters)
+	{
+		var parameterPointers = (IntPtr*)InNativeArray;
+
+		for (int i = 0; i < OutParameters.Length; i++)
+			OutParameters[i] = MarshalPointer(parameterPointers[i], InParameterTypes[i]);
+	}
 	
 }
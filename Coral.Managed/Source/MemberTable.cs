@@ -0,0 +1,195 @@
+using System;
+using System.Collections.Generic;
+using System.Reflection;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace Coral.Managed;
+
+using static TypeInterface;
+
+// Packs the methods and fields of every type in an assembly into a single native buffer, which native code persists next to the
+// TypeTable in its metadata cache so later runs can enumerate members without reflecting. Layout (all 4 byte aligned, see
+// Coral.Native/Source/Coral/TypeTable.hpp):
+//   MemberTableHeader
+//   MemberTableType[TypeCount]       one per local type, in the same order as the TypeTable's local entries
+//   MemberTableMethod[MethodCount]   what GetTypeMethods reports for each type, each type owns the range [FirstMethod, FirstMethod + MethodCount)
+//   MemberTableField[FieldCount]     what GetTypeFields reports for each type
+//   int[ParameterCount]              parameter types, each method owns the range [FirstParameter, FirstParameter + ParameterCount)
+//   byte[StringPoolSize]             UTF-8 member names, referenced by NameOffset / NameLength
+// Types are referenced locally rather than by ID: their index in the TypeTable's local entries + 1, with 0 meaning "ask the runtime",
+// which is what every type defined by another assembly is stored as.
+// The buffer is allocated with Marshal.AllocHGlobal and owned by native code afterwards.
+internal static class MemberTable
+{
+	[StructLayout(LayoutKind.Sequential)]
+	internal struct MemberTableHeader
+	{
+		public int TypeCount;
+		public int MethodCount;
+		public int FieldCount;
+		public int ParameterCount;
+		public int StringPoolSize;
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	internal struct MemberTableType
+	{
+		public int FirstMethod;
+		public int MethodCount;
+		public int FirstField;
+		public int FieldCount;
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	internal struct MemberTableMethod
+	{
+		public int Token;
+		public int NameOffset;
+		public int NameLength;
+		public TypeAccessibility Accessibility;
+		public int ReturnType;
+		public int FirstParameter;
+		public int ParameterCount;
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	internal struct MemberTableField
+	{
+		public int Token;
+		public int NameOffset;
+		public int NameLength;
+		public TypeAccessibility Accessibility;
+		public int FieldType;
+	}
+
+	internal const BindingFlags MemberBindingFlags = BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance | BindingFlags.Static;
+
+	internal static unsafe IntPtr Build(Assembly InAssembly)
+	{
+		var types = InAssembly.GetTypes();
+
+		var localReferences = new Dictionary<Type, int>(types.Length);
+		foreach (var type in types)
+			localReferences.TryAdd(type, localReferences.Count + 1);
+
+		int GetLocalReference(Type InType) => localReferences.TryGetValue(InType, out int reference) ? reference : 0;
+
+		var typeEntries = new List<MemberTableType>(types.Length);
+		var methods = new List<MemberTableMethod>();
+		var fields = new List<MemberTableField>();
+		var parameters = new List<int>();
+		var names = new List<string>();
+		int stringPoolSize = 0;
+
+		int AddName(string InName, out int OutLength)
+		{
+			int offset = stringPoolSize;
+			OutLength = Encoding.UTF8.GetByteCount(InName);
+			names.Add(InName);
+			stringPoolSize += OutLength;
+			return offset;
+		}
+
+		foreach (var type in types)
+		{
+			var typeEntry = new MemberTableType { FirstMethod = methods.Count, FirstField = fields.Count };
+
+			foreach (var method in type.GetMethods(MemberBindingFlags))
+			{
+				var entry = new MemberTableMethod
+				{
+					Token = method.MetadataToken,
+					Accessibility = GetTypeAccessibility(method),
+					ReturnType = GetLocalReference(method.ReturnType),
+					FirstParameter = parameters.Count,
+				};
+
+				entry.NameOffset = AddName(method.Name, out entry.NameLength);
+
+				foreach (var parameter in method.GetParameters())
+					parameters.Add(GetLocalReference(parameter.ParameterType));
+
+				entry.ParameterCount = parameters.Count - entry.FirstParameter;
+				methods.Add(entry);
+			}
+
+			foreach (var field in type.GetFields(MemberBindingFlags))
+			{
+				var entry = new MemberTableField
+				{
+					Token = field.MetadataToken,
+					Accessibility = GetTypeAccessibility(field),
+					FieldType = GetLocalReference(field.FieldType),
+				};
+
+				entry.NameOffset = AddName(field.Name, out entry.NameLength);
+				fields.Add(entry);
+			}
+
+			typeEntry.MethodCount = methods.Count - typeEntry.FirstMethod;
+			typeEntry.FieldCount = fields.Count - typeEntry.FirstField;
+			typeEntries.Add(typeEntry);
+		}
+
+		var header = new MemberTableHeader
+		{
+			TypeCount = typeEntries.Count,
+			MethodCount = methods.Count,
+			FieldCount = fields.Count,
+			ParameterCount = parameters.Count,
+			StringPoolSize = stringPoolSize,
+		};
+
+		int typesSize = typeEntries.Count * sizeof(MemberTableType);
+		int methodsSize = methods.Count * sizeof(MemberTableMethod);
+		int fieldsSize = fields.Count * sizeof(MemberTableField);
+		int parametersSize = parameters.Count * sizeof(int);
+		var buffer = Marshal.AllocHGlobal(sizeof(MemberTableHeader) + typesSize + methodsSize + fieldsSize + parametersSize + stringPoolSize);
+		var data = (byte*)buffer;
+
+		*(MemberTableHeader*)data = header;
+		data += sizeof(MemberTableHeader);
+
+		CopyTo(typeEntries, data);
+		data += typesSize;
+
+		CopyTo(methods, data);
+		data += methodsSize;
+
+		CopyTo(fields, data);
+		data += fieldsSize;
+
+		CopyTo(parameters, data);
+		data += parametersSize;
+
+		var strings = new Span<byte>(data, stringPoolSize);
+
+		foreach (var name in names)
+			strings = strings[Encoding.UTF8.GetBytes(name, strings)..];
+
+		return buffer;
+	}
+
+	// Finds the member a cache entry was written for. InIndex is where it was when the cache was written, which is where it
+	// still is unless an assembly the type inherits from changed, so the token and name only have to be searched for as a fallback.
+	internal static T? FindMember<T>(ReadOnlySpan<T> InMembers, int InIndex, int InToken, string? InName) where T : MemberInfo
+	{
+		if ((uint)InIndex < (uint)InMembers.Length && InMembers[InIndex].MetadataToken == InToken && InMembers[InIndex].Name == InName)
+			return InMembers[InIndex];
+
+		foreach (var member in InMembers)
+		{
+			if (member.MetadataToken == InToken && member.Name == InName)
+				return member;
+		}
+
+		return null;
+	}
+
+	private static unsafe void CopyTo<T>(List<T> InList, byte* InDestination) where T : unmanaged
+	{
+		var source = CollectionsMarshal.AsSpan(InList);
+		source.CopyTo(new Span<T>(InDestination, source.Length));
+	}
+}
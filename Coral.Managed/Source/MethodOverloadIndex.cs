@@ -0,0 +1,108 @@
+using System;
+using System.Collections.Generic;
+using System.Reflection;
+using System.Threading;
+
+namespace Coral.Managed;
+
+// Overloads of a type grouped by (name, parameter count), with each signature converted to ManagedType once.
+// Built the first time a method or constructor of the type is resolved, so overload resolution only has to look at
+// the candidates that can actually match and never calls GetParameters() or ToString() again.
+internal sealed class MethodOverloadIndex<T> where T : MethodBase
+{
+	private readonly struct Overload
+	{
+		public readonly T Method;
+		public readonly ManagedType[] ParameterTypes;
+
+		public Overload(T InMethod, ManagedType[] InParameterTypes)
+		{
+			Method = InMethod;
+			ParameterTypes = InParameterTypes;
+		}
+	}
+
+	private readonly T[] m_Methods;
+	private readonly Dictionary<(string Name, int ParameterCount), Overload[]> m_Overloads = new();
+
+	// Methods keyed by their full signature (MethodBase.ToString()), only built if a lookup actually passes one
+	private Dictionary<string, T>? m_Signatures;
+
+	public MethodOverloadIndex(T[] InMethods)
+	{
+		m_Methods = InMethods;
+
+		var overloads = new Dictionary<(string, int), List<Overload>>();
+
+		foreach (var method in InMethods)
+		{
+			var parameters = method.GetParameters();
+			var parameterTypes = new ManagedType[parameters.Length];
+
+			for (int i = 0; i < parameters.Length; i++)
+				parameterTypes[i] = TypeInterface.GetManagedType(parameters[i].ParameterType);
+
+			var key = (method.Name, parameters.Length);
+
+			if (!overloads.TryGetValue(key, out var list))
+			{
+				list = new List<Overload>();
+				overloads.Add(key, list);
+			}
+
+			list.Add(new Overload(method, parameterTypes));
+		}
+
+		foreach (var (key, list) in overloads)
+			m_Overloads.Add(key, list.ToArray());
+	}
+
+	// Returns the first overload named InMethodName whose parameters match InParameterTypes.
+	// InMethodName can also be a full signature (e.g "Void Foo(Int32)"), in which case the parameter types aren't checked.
+	public unsafe T? FindSuitableMethod(string? InMethodName, ManagedType* InParameterTypes, int InParameterCount)
+	{
+		if (InMethodName == null)
+			return null;
+
+		if (InMethodName.Contains('('))
+			return FindBySignature(InMethodName, InParameterCount);
+
+		if (!m_Overloads.TryGetValue((InMethodName, InParameterCount), out var overloads))
+			return null;
+
+		foreach (var overload in overloads)
+		{
+			var parameterTypes = overload.ParameterTypes;
+			int i = 0;
+
+			while (i < InParameterCount && parameterTypes[i] == InParameterTypes[i])
+				i++;
+
+			if (i == InParameterCount)
+				return overload.Method;
+		}
+
+		return null;
+	}
+
+	private T? FindBySignature(string InSignature, int InParameterCount)
+	{
+		var signatures = Volatile.Read(ref m_Signatures);
+
+		if (signatures == null)
+		{
+			// Racing threads build identical maps, whichever is published first is kept
+			signatures = new Dictionary<string, T>();
+
+			foreach (var method in m_Methods)
+				signatures.TryAdd(method.ToString()!, method);
+
+			signatures = Interlocked.CompareExchange(ref m_Signatures, signatures, null) ?? signatures;
+		}
+
+		if (!signatures.TryGetValue(InSignature, out var result) || result.GetParameters().Length != InParameterCount)
+			return null;
+
+		return result;
+	}
+}
@@ -0,0 +1,68 @@
+using Coral.Managed.Interop;
+
+using System;
+using System.Collections.Concurrent;
+using System.Runtime.InteropServices;
+
+namespace Coral.Managed;
+
+using static ManagedHost;
+
+// Interned member names, native code passes the ID instead of marshalling the name on every call.
+// Names aren't tied to an AssemblyLoadContext so IDs stay valid across unloads.
+internal static class NameTable
+{
+	private static readonly DenseIdList<string> s_Names = new();
+	private static readonly ConcurrentDictionary<string, int> s_Ids = new();
+	private static readonly object s_Lock = new();
+
+	[UnmanagedCallersOnly]
+	internal static int InternName(NativeString InName)
+	{
+		try
+		{
+			string? name = InName;
+
+			if (name == null)
+			{
+				LogMessage("Cannot intern a null name.", MessageLevel.Error);
+				return -1;
+			}
+
+			return Intern(name);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return -1;
+		}
+	}
+
+	internal static int Intern(string InName)
+	{
+		if (s_Ids.TryGetValue(InName, out int id))
+			return id;
+
+		lock (s_Lock)
+		{
+			if (!s_Ids.TryGetValue(InName, out id))
+			{
+				id = s_Names.Add(InName);
+				s_Ids.TryAdd(InName, id);
+			}
+
+			return id;
+		}
+	}
+
+	internal static string? GetName(int InNameId)
+	{
+		if (!s_Names.TryGetValue(InNameId, out var name))
+		{
+			LogMessage($"Invalid name id '{InNameId}'. Names have to be interned with HostInstance::InternName.", MessageLevel.Error);
+			return null;
+		}
+
+		return name;
+	}
+}
@@ -0,0 +1,10 @@
+using System;
+
+namespace Coral.Managed.Interop;
+
+// Marks a static method as callable directly from native code through `ManagedAssembly::GetFunctionPointer`.
+// The method must also be marked with [UnmanagedCallersOnly] and may only use blittable parameter and return types.
+[AttributeUsage(AttributeTargets.Method, AllowMultiple = false, Inherited = false)]
+public sealed class NativeCallableAttribute : Attribute
+{
+}
@@ -0,0 +1,219 @@
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Runtime.Loader;
+using System.Threading;
+
+namespace Coral.Managed;
+
+using static ManagedHost;
+
+// Maps the handles stored in Coral::ManagedObject and Coral::WeakManagedObject to the objects they refer to.
+// Unless the host turns off HostSettings::UseObjectHandleTable every handle is a slot in a growable slab with a free list,
+// which avoids the global lock taken by GCHandle.Alloc for strong references and keeps the GC from having to scan one
+// strong handle per object. Weak references hold a WeakTarget in their slot instead of the object.
+// Slot handles are encoded as (index << 32) | (generation << 1) | 1, so no handle is ever zero.
+// Every lookup validates the generation, so using a destroyed object is reported instead of being undefined behaviour.
+// With the table turned off handles are raw GCHandles, which are pointer aligned so the low bit tells them apart.
+//
+// Only Allocate and Free take the lock, lookups don't. The slab grows by adding fixed size chunks that are never moved,
+// so a slot stays put while it's being read, and Get re-checks the generation after reading the target in case the
+// slot was freed (and possibly reused) in between.
+internal static class ObjectHandleTable
+{
+	private struct Slot
+	{
+		public object? Target;
+		public uint Generation;
+		public int NextFree;
+	}
+
+	// Owned by its slot rather than freed explicitly, so a lookup racing with Free can't read a released GCHandle
+	private sealed class WeakTarget : WeakReference
+	{
+		public WeakTarget(object? InTarget) : base(InTarget) { }
+	}
+
+	private const int ChunkShift = 10;
+	private const int ChunkSize = 1 << ChunkShift;
+	private const int ChunkMask = ChunkSize - 1;
+	private const uint GenerationMask = 0x7FFFFFFF;
+
+	// Copied into a larger array when it runs out of room, a reader still holding the old one finds every chunk below the count it read
+	private static Slot[]?[] s_Chunks = new Slot[]?[16];
+	private static int s_Count;
+	private static int s_FreeHead = -1;
+	private static readonly object s_Lock = new();
+
+	internal static bool s_Enabled = true;
+
+	internal static IntPtr Allocate(object? InObject, bool InWeakRef = false)
+	{
+		if (!s_Enabled)
+			return GCHandle.ToIntPtr(GCHandle.Alloc(InObject, InWeakRef ? GCHandleType.Weak : GCHandleType.Normal));
+
+		object? target = InWeakRef ? new WeakTarget(InObject) : InObject;
+
+		lock (s_Lock)
+		{
+			int index;
+
+			if (s_FreeHead != -1)
+			{
+				index = s_FreeHead;
+				s_FreeHead = GetSlot(s_Chunks, index).NextFree;
+			}
+			else
+			{
+				index = s_Count;
+
+				if ((index & ChunkMask) == 0)
+					AddChunk(index >> ChunkShift);
+
+				// Published after the chunk, so a reader that sees the new count also sees the chunk
+				Volatile.Write(ref s_Count, index + 1);
+			}
+
+			ref var slot = ref GetSlot(s_Chunks, index);
+			slot.NextFree = -1;
+			Volatile.Write(ref slot.Target, target);
+			return Encode(index, slot.Generation);
+		}
+	}
+
+	// Reports null, stale and unknown handles. A weak handle whose target has been collected returns null without reporting anything
+	internal static object? Get(IntPtr InHandle)
+	{
+		if (InHandle == IntPtr.Zero)
+		{
+			LogMessage("Invalid object handle (null), the object was either never created or has been moved from.", MessageLevel.Error);
+			return null;
+		}
+
+		if (!IsSlotHandle(InHandle))
+			return GCHandle.FromIntPtr(InHandle).Target;
+
+		Decode(InHandle, out int index, out uint generation);
+
+		// The count has to be read before the chunks, see Allocate
+		if ((uint)index >= (uint)Volatile.Read(ref s_Count))
+		{
+			ReportInvalidHandle(index, generation);
+			return null;
+		}
+
+		ref var slot = ref GetSlot(Volatile.Read(ref s_Chunks), index);
+
+		if (Volatile.Read(ref slot.Generation) != generation)
+		{
+			ReportInvalidHandle(index, generation);
+			return null;
+		}
+
+		var target = Volatile.Read(ref slot.Target);
+
+		// Free bumps the generation before clearing the target, so if it's unchanged the target still belongs to this handle
+		if (Volatile.Read(ref slot.Generation) != generation)
+		{
+			ReportInvalidHandle(index, generation);
+			return null;
+		}
+
+		return target is WeakTarget weakTarget ? weakTarget.Target : target;
+	}
+
+	// Kept out of Get so the validation on the hot path is only the bounds and generation compare
+	[MethodImpl(MethodImplOptions.NoInlining)]
+	private static void ReportInvalidHandle(int InIndex, uint InGeneration)
+	{
+		if ((uint)InIndex >= (uint)Volatile.Read(ref s_Count))
+		{
+			LogMessage($"Invalid object handle (slot {InIndex} is out of range), the handle was never allocated by Coral.", MessageLevel.Error);
+			return;
+		}
+
+		uint currentGeneration = Volatile.Read(ref GetSlot(Volatile.Read(ref s_Chunks), InIndex).Generation);
+		LogMessage($"Stale object handle (slot {InIndex}, generation {InGeneration}, current generation {currentGeneration}), the object has already been destroyed.", MessageLevel.Error);
+	}
+
+	internal static void Free(IntPtr InHandle)
+	{
+		if (!IsSlotHandle(InHandle))
+		{
+			GCHandle.FromIntPtr(InHandle).Free();
+			return;
+		}
+
+		Decode(InHandle, out int index, out uint generation);
+
+		lock (s_Lock)
+		{
+			if ((uint)index >= (uint)s_Count || GetSlot(s_Chunks, index).Generation != generation)
+			{
+				LogMessage($"Attempted to free an object handle that has already been freed (slot {index}, generation {generation}).", MessageLevel.Error);
+				return;
+			}
+
+			FreeSlot(index);
+		}
+	}
+
+	// Frees every object in the table that was loaded from InContext, otherwise they would keep the context from unloading.
+	// Raw GCHandles aren't tracked anywhere, so with the table turned off leftover objects stay alive.
+	// Weak references don't keep their target alive so they're left for their owners to free.
+	// If you see these warnings it probably means you're mis-managing the lifetime of a ManagedObject.
+	internal static void FreeObjectsFromContext(AssemblyLoadContext InContext)
+	{
+		lock (s_Lock)
+		{
+			for (int i = 0; i < s_Count; i++)
+			{
+				var target = GetSlot(s_Chunks, i).Target;
+
+				if (target == null || target is WeakTarget || AssemblyLoadContext.GetLoadContext(target.GetType().Assembly) != InContext)
+					continue;
+
+				LogMessage($"Found unfreed object '{target}' from assembly '{target.GetType().Assembly.GetName()}'. Deallocating.", MessageLevel.Warning);
+				FreeSlot(i);
+			}
+		}
+	}
+
+	private static void FreeSlot(int InIndex)
+	{
+		ref var slot = ref GetSlot(s_Chunks, InIndex);
+
+		// Invalidates the handle before the target is cleared, see Get
+		Volatile.Write(ref slot.Generation, (slot.Generation + 1) & GenerationMask);
+		Volatile.Write(ref slot.Target, null);
+		slot.NextFree = s_FreeHead;
+		s_FreeHead = InIndex;
+	}
+
+	private static void AddChunk(int InChunkIndex)
+	{
+		var chunks = s_Chunks;
+
+		if (InChunkIndex == chunks.Length)
+		{
+			chunks = new Slot[]?[chunks.Length * 2];
+			Array.Copy(s_Chunks, chunks, s_Chunks.Length);
+		}
+
+		chunks[InChunkIndex] = new Slot[ChunkSize];
+		Volatile.Write(ref s_Chunks, chunks);
+	}
+
+	private static ref Slot GetSlot(Slot[]?[] InChunks, int InIndex) => ref InChunks[InIndex >> ChunkShift]![InIndex & ChunkMask];
+
+	private static bool IsSlotHandle(IntPtr InHandle) => (InHandle.ToInt64() & 1) != 0;
+
+	private static IntPtr Encode(int InIndex, uint InGeneration) => new(((long)InIndex << 32) | ((long)InGeneration << 1) | 1);
+
+	private static void Decode(IntPtr InHandle, out int OutIndex, out uint OutGeneration)
+	{
+		long value = InHandle.ToInt64();
+		OutIndex = (int)(value >> 32);
+		OutGeneration = (uint)(value >> 1) & GenerationMask;
+	}
+}
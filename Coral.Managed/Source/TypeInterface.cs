@@ -1,6 +1,8 @@
 ﻿using Coral.Managed.Interop;
 
 using System;
+using System.Collections.Concurrent;
+using System.Collections.Frozen;
 using System.Collections.Generic;
 using System.Collections.Immutable;
 using System.Diagnostics;
@@ -45,7 +47,7 @@ internal static class TypeInterface
 		return InType.Assembly.CreateInstance(InType.FullName ?? string.Empty, false, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance, null, InArguments!, null, null);
 	}
 
-	private static Dictionary<Type, ManagedType> s_TypeConverters = new()
+	private static readonly FrozenDictionary<Type, ManagedType> s_TypeConverters = new Dictionary<Type, ManagedType>()
 	{
 		{ typeof(sbyte), ManagedType.SByte },
 		{ typeof(byte), ManagedType.Byte },
@@ -61,61 +63,49 @@ internal static class TypeInterface
 		{ typeof(bool), ManagedType.Bool },
 		{ typeof(NativeString), ManagedType.String },
 		{ typeof(string), ManagedType.String },
-	};
+	}.ToFrozenDictionary();
 
-	internal static unsafe T? FindSuitableMethod<T>(string? InMethodName, ManagedType* InParameterTypes, int InParameterCount, ReadOnlySpan<T> InMethods) where T : MethodBase
-	{
-		if (InMethodName == null)
-			return null;
-
-		T? result = null;
-
-		foreach (var methodInfo in InMethods)
-		{
-			var methodParams = methodInfo.GetParameters();
+	private static readonly ConcurrentDictionary<(Type, BindingFlags), MethodOverloadIndex<MethodInfo>> s_MethodIndices = new();
+	private static readonly ConcurrentDictionary<Type, MethodOverloadIndex<ConstructorInfo>> s_ConstructorIndices = new();
 
-			if (methodParams.Length != InParameterCount)
-				continue;
+	internal static ManagedType GetManagedType(Type InType)
+	{
+		if (InType.IsPointer || InType == typeof(IntPtr))
+			return ManagedType.Pointer;
 
-			// Check if the method name matches the signature of methodInfo, if so we ignore the automatic type checking
-			if (InMethodName == methodInfo.ToString())
-			{
-				result = methodInfo;
-				break;
-			}
+		return s_TypeConverters.TryGetValue(InType, out var managedType) ? managedType : ManagedType.Unknown;
+	}
 
-			if (methodInfo.Name != InMethodName)
-				continue;
+	// Methods of InType and all of its base types, in that order, so overrides are found before the methods they override
+	internal static MethodOverloadIndex<MethodInfo> GetMethodIndex(Type InType, BindingFlags InBindingFlags)
+	{
+		if (s_MethodIndices.TryGetValue((InType, InBindingFlags), out var index))
+			return index;
 
-			int matchingTypes = 0;
+		List<MethodInfo> methods = new(InType.GetMethods(InBindingFlags));
 
-			for (int i = 0; i < methodParams.Length; i++)
-			{
-				ManagedType paramType;
+		Type? baseType = InType.BaseType;
+		while (baseType != null)
+		{
+			methods.AddRange(baseType.GetMethods(InBindingFlags));
+			baseType = baseType.BaseType;
+		}
 
-				if (methodParams[i].ParameterType.IsPointer || methodParams[i].ParameterType == typeof(IntPtr))
-				{
-					paramType = ManagedType.Pointer;
-				}
-				else if (!s_TypeConverters.TryGetValue(methodParams[i].ParameterType, out paramType))
-				{
-					paramType = ManagedType.Unknown;
-				}
+		return s_MethodIndices.GetOrAdd((InType, InBindingFlags), new MethodOverloadIndex<MethodInfo>(methods.ToArray()));
+	}
 
-				if (paramType == InParameterTypes[i])
-				{
-					matchingTypes++;
-				}
-			}
+	internal static MethodOverloadIndex<ConstructorInfo> GetConstructorIndex(Type InType)
+	{
+		if (s_ConstructorIndices.TryGetValue(InType, out var index))
+			return index;
 
-			if (matchingTypes == InParameterCount)
-			{
-				result = methodInfo;
-				break;
-			}
-		}
+		return s_ConstructorIndices.GetOrAdd(InType, new MethodOverloadIndex<ConstructorInfo>(InType.GetConstructors(BindingFlags.NonPublic | BindingFlags.Public | BindingFlags.Instance)));
+	}
 
-		return result;
+	internal static void ClearOverloadIndices()
+	{
+		s_MethodIndices.Clear();
+		s_ConstructorIndices.Clear();
 	}
 
 	[UnmanagedCallersOnly]
@@ -154,6 +144,214 @@ internal static class TypeInterface
 		}
 	}
 
+	// Returns a TypeTable buffer describing every type in the assembly, or null if the assembly couldn't be found.
+	// The caller owns the buffer and has to free it with Memory::FreeHGlobal.
+	[UnmanagedCallersOnly]
+	internal static IntPtr GetAssemblyTypeTable(int InAssemblyLoadContextId, int InAssemblyId)
+	{
+		try
+		{
+			if (!AssemblyLoader.TryGetAssembly(InAssemblyLoadContextId, InAssemblyId, out var assembly) || assembly == null)
+			{
+				LogMessage($"Couldn't get types for assembly '{InAssemblyId}', assembly not found.", MessageLevel.Error);
+				return IntPtr.Zero;
+			}
+
+			return TypeTable.Build(assembly);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return IntPtr.Zero;
+		}
+	}
+
+	// Writes the 16 byte module version IDs of the assembly's manifest module and of System.Private.CoreLib, which are part of the key
+	// native code validates metadata cache files against. The runtime decides which inherited members reflection reports, so a
+	// cache file written by a different runtime build can't be trusted either.
+	[UnmanagedCallersOnly]
+	internal static unsafe Bool32 GetAssemblyModuleVersionId(int InAssemblyLoadContextId, int InAssemblyId, Guid* OutModuleVersionId, Guid* OutCoreLibModuleVersionId)
+	{
+		try
+		{
+			if (!AssemblyLoader.TryGetAssembly(InAssemblyLoadContextId, InAssemblyId, out var assembly) || assembly == null)
+				return false;
+
+			*OutModuleVersionId = assembly.ManifestModule.ModuleVersionId;
+			*OutCoreLibModuleVersionId = typeof(object).Module.ModuleVersionId;
+			return true;
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return false;
+		}
+	}
+
+	// Hands out IDs for the types of a cached TypeTable without enumerating the assembly, InTypeTokens holds the TypeDef token of each
+	// local entry. A type is only loaded once its ID is first used, types added any other way are mapped back to their reserved ID.
+	// Returns the ID of the first entry (the others follow in order), or 0 if the tokens can't belong to the assembly.
+	[UnmanagedCallersOnly]
+	internal static unsafe int ReserveAssemblyTypeIds(int InAssemblyLoadContextId, int InAssemblyId, int* InTypeTokens, int InTypeCount)
+	{
+		try
+		{
+			if (!AssemblyLoader.TryGetAssembly(InAssemblyLoadContextId, InAssemblyId, out var assembly) || assembly == null)
+				return 0;
+
+			var module = assembly.ManifestModule;
+			var tokens = new ReadOnlySpan<int>(InTypeTokens, InTypeCount).ToArray();
+
+			foreach (int token in tokens)
+			{
+				if ((token & 0xFF000000) != 0x02000000)
+					return 0;
+			}
+
+			// Only needed once a type is added before its ID was used, which most loads never do
+			Dictionary<int, int>? indices = null;
+
+			int IndexOf(Type InType)
+			{
+				if (InType.Module != module || !InType.IsTypeDefinition)
+					return -1;
+
+				if (indices == null)
+				{
+					indices = new Dictionary<int, int>(tokens.Length);
+					for (int i = 0; i < tokens.Length; i++)
+						indices.TryAdd(tokens[i], i);
+				}
+
+				return indices.TryGetValue(InType.MetadataToken, out int index) ? index : -1;
+			}
+
+			Type? Resolve(int InIndex)
+			{
+				try
+				{
+					return module.ResolveType(tokens[InIndex]);
+				}
+				catch (ArgumentException)
+				{
+					LogMessage($"Type token 0x{tokens[InIndex]:X8} from the metadata cache doesn't exist in assembly '{assembly.GetName()}'.", MessageLevel.Error);
+					return null;
+				}
+			}
+
+			return s_CachedTypes.Reserve(tokens.Length, Resolve, IndexOf);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return 0;
+		}
+	}
+
+	// Returns a MemberTable buffer describing the methods and fields of every type in the assembly, or null if the assembly couldn't be found.
+	// The caller owns the buffer and has to free it with Memory::FreeHGlobal.
+	[UnmanagedCallersOnly]
+	internal static IntPtr GetAssemblyMemberTable(int InAssemblyLoadContextId, int InAssemblyId)
+	{
+		try
+		{
+			if (!AssemblyLoader.TryGetAssembly(InAssemblyLoadContextId, InAssemblyId, out var assembly) || assembly == null)
+			{
+				LogMessage($"Couldn't get members for assembly '{InAssemblyId}', assembly not found.", MessageLevel.Error);
+				return IntPtr.Zero;
+			}
+
+			return MemberTable.Build(assembly);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return IntPtr.Zero;
+		}
+	}
+
+	// Resolves a method native code enumerated from its metadata cache, InIndex is its position in what GetTypeMethods reports.
+	// Returns 0 if the type no longer has that method.
+	[UnmanagedCallersOnly]
+	internal static int ResolveTypeMethod(int InType, int InIndex, int InToken, NativeString InName)
+	{
+		try
+		{
+			if (!s_CachedTypes.TryGetValue(InType, out var type) || type == null)
+				return 0;
+
+			string? name = InName;
+			var method = MemberTable.FindMember<MethodInfo>(type.GetMethods(MemberTable.MemberBindingFlags), InIndex, InToken, name);
+
+			if (method == null)
+			{
+				LogMessage($"Method '{name}' from the metadata cache doesn't exist on type '{type.FullName}'.", MessageLevel.Error);
+				return 0;
+			}
+
+			return s_CachedMethods.Add(method);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return 0;
+		}
+	}
+
+	// Same as ResolveTypeMethod, for fields
+	[UnmanagedCallersOnly]
+	internal static int ResolveTypeField(int InType, int InIndex, int InToken, NativeString InName)
+	{
+		try
+		{
+			if (!s_CachedTypes.TryGetValue(InType, out var type) || type == null)
+				return 0;
+
+			string? name = InName;
+			var field = MemberTable.FindMember<FieldInfo>(type.GetFields(MemberTable.MemberBindingFlags), InIndex, InToken, name);
+
+			if (field == null)
+			{
+				LogMessage($"Field '{name}' from the metadata cache doesn't exist on type '{type.FullName}'.", MessageLevel.Error);
+				return 0;
+			}
+
+			return s_CachedFields.Add(field);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return 0;
+		}
+	}
+
+	// Resolves a single type by its full name, used instead of GetAssemblyTypes when the host loads types lazily.
+	// Returns 0 if the assembly doesn't define a type with that name.
+	[UnmanagedCallersOnly]
+	internal static int GetAssemblyType(int InAssemblyLoadContextId, int InAssemblyId, NativeString InTypeName)
+	{
+		try
+		{
+			string? typeName = InTypeName;
+
+			if (typeName == null || !AssemblyLoader.TryGetAssembly(InAssemblyLoadContextId, InAssemblyId, out var assembly) || assembly == null)
+				return 0;
+
+			// GetType also parses array and generic instantiation syntax, only accept types the assembly itself defines
+			var type = assembly.GetType(typeName, false);
+
+			if (type == null || type.FullName != typeName)
+				return 0;
+
+			return s_CachedTypes.Add(type);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return 0;
+		}
+	}
+
 	[UnmanagedCallersOnly]
 	internal static unsafe NativeString GetFullTypeName(int InType)
 	{
@@ -377,7 +575,7 @@ internal static class TypeInterface
 			if (!s_CachedTypes.TryGetValue(InType, out var type) || type == null)
 				return;
 
-			ReadOnlySpan<MethodInfo> methods = type.GetMethods(BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance | BindingFlags.Static);
+			ReadOnlySpan<MethodInfo> methods = type.GetMethods(MemberTable.MemberBindingFlags);
 
 			if (methods.Length == 0)
 			{
@@ -409,7 +607,7 @@ internal static class TypeInterface
 			if (!s_CachedTypes.TryGetValue(InType, out var type) || type == null)
 				return;
 
-			ReadOnlySpan<FieldInfo> fields = type.GetFields(BindingFlags.Instance | BindingFlags.Static | BindingFlags.NonPublic | BindingFlags.Public);
+			ReadOnlySpan<FieldInfo> fields = type.GetFields(MemberTable.MemberBindingFlags);
 
 			if (fields.Length == 0)
 			{
@@ -643,7 +841,7 @@ internal static class TypeInterface
 		PrivateProtected
 	}
 
-	private static TypeAccessibility GetTypeAccessibility(FieldInfo InFieldInfo)
+	internal static TypeAccessibility GetTypeAccessibility(FieldInfo InFieldInfo)
 	{
 		if (InFieldInfo.IsPublic) return TypeAccessibility.Public;
 		if (InFieldInfo.IsPrivate) return TypeAccessibility.Private;
@@ -654,7 +852,7 @@ internal static class TypeInterface
 		return TypeAccessibility.Public;
 	}
 
-	private static TypeAccessibility GetTypeAccessibility(MethodInfo InMethodInfo)
+	internal static TypeAccessibility GetTypeAccessibility(MethodInfo InMethodInfo)
 	{
 		if (InMethodInfo.IsPublic) return TypeAccessibility.Public;
 		if (InMethodInfo.IsPrivate) return TypeAccessibility.Private;
@@ -854,6 +1052,36 @@ internal static class TypeInterface
 		}
 	}
 
+	[UnmanagedCallersOnly]
+	internal static void GetAttributeFieldValueByNameId(int InAttribute, int InNameId, IntPtr OutValue)
+	{
+		try
+		{
+			var fieldName = NameTable.GetName(InNameId);
+
+			if (fieldName == null)
+				return;
+
+			if (!s_CachedAttributes.TryGetValue(InAttribute, out var attribute) || attribute == null)
+				return;
+
+			var targetType = attribute.GetType();
+			var fieldInfo = targetType.GetField(fieldName, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
+
+			if (fieldInfo == null)
+			{
+				LogMessage($"Failed to find field with name '{fieldName}' in attribute {targetType.FullName}.", MessageLevel.Error);
+				return;
+			}
+
+			Marshalling.MarshalReturnValue(attribute, fieldInfo.GetValue(attribute), fieldInfo, OutValue);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
 	[UnmanagedCallersOnly]
 	internal static unsafe void GetAttributeType(int InAttribute, int* OutType)
 	{
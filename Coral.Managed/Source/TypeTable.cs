@@ -0,0 +1,168 @@
+using System;
+using System.Collections.Generic;
+using System.Reflection;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace Coral.Managed;
+
+// Packs the metadata of every type in an assembly into a single native buffer, so ManagedAssembly can build its type
+// table without calling back into managed code for each type. Layout (all 4 byte aligned, see Coral.Native/Source/Coral/TypeTable.hpp):
+//   TypeTableHeader
+//   TypeTableEntry[EntryCount]   the assembly's own types first, followed by the base types and interfaces they reference from other assemblies
+//   int[InterfaceCount]          interface type ids, each entry owns the range [FirstInterface, FirstInterface + InterfaceCount)
+//   byte[StringPoolSize]         UTF-8 full names, referenced by NameOffset / NameLength
+// The buffer is allocated with Marshal.AllocHGlobal and owned by native code afterwards.
+internal static class TypeTable
+{
+	[Flags]
+	internal enum TypeFlags : uint
+	{
+		None = 0,
+		IsSZArray = 1 << 0,
+		// Referenced by one of the assembly's types but defined somewhere else
+		External = 1 << 1,
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	internal struct TypeTableHeader
+	{
+		public int TypeCount;
+		public int EntryCount;
+		public int InterfaceCount;
+		public int StringPoolSize;
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	internal struct TypeTableEntry
+	{
+		public int Id;
+		public int BaseTypeId;
+		public int Size;
+		public ManagedType ManagedType;
+		public TypeFlags Flags;
+		public int NameOffset;
+		public int NameLength;
+		public int FirstInterface;
+		public int InterfaceCount;
+		// TypeDef token of the assembly's own types, lets a cached table bind its entries to types without enumerating the assembly
+		public int Token;
+	}
+
+	internal static unsafe IntPtr Build(Assembly InAssembly)
+	{
+		var types = new List<Type>(InAssembly.GetTypes());
+		int typeCount = types.Count;
+
+		// Registering a type appends it to `types` the first time it's seen, external types end up after the local ones
+		var indices = new Dictionary<Type, int>(typeCount);
+		foreach (var type in types)
+			indices.TryAdd(type, indices.Count);
+
+		var interfaces = new List<int>();
+		var entries = new List<TypeTableEntry>(typeCount);
+		var names = new List<string>(typeCount);
+		int stringPoolSize = 0;
+
+		for (int i = 0; i < types.Count; i++)
+		{
+			var type = types[i];
+			var flags = i < typeCount ? TypeFlags.None : TypeFlags.External;
+
+			if (type.IsSZArray)
+				flags |= TypeFlags.IsSZArray;
+
+			var entry = new TypeTableEntry
+			{
+				Id = TypeInterface.s_CachedTypes.Add(type),
+				Size = GetSize(type),
+				ManagedType = TypeInterface.GetManagedType(type),
+				Flags = flags,
+				NameOffset = stringPoolSize,
+				FirstInterface = interfaces.Count,
+			};
+
+			var name = type.FullName ?? type.Name;
+			names.Add(name);
+			entry.NameLength = Encoding.UTF8.GetByteCount(name);
+			stringPoolSize += entry.NameLength;
+
+			// Only the assembly's own types describe their hierarchy, external types are resolved on demand like any other type
+			if (i < typeCount)
+			{
+				if (type.Module == InAssembly.ManifestModule)
+					entry.Token = type.MetadataToken;
+
+				if (type.BaseType != null)
+					entry.BaseTypeId = TypeInterface.s_CachedTypes.Add(Register(type.BaseType, types, indices));
+
+				foreach (var interfaceType in type.GetInterfaces())
+					interfaces.Add(TypeInterface.s_CachedTypes.Add(Register(interfaceType, types, indices)));
+
+				entry.InterfaceCount = interfaces.Count - entry.FirstInterface;
+			}
+
+			entries.Add(entry);
+		}
+
+		var header = new TypeTableHeader
+		{
+			TypeCount = typeCount,
+			EntryCount = entries.Count,
+			InterfaceCount = interfaces.Count,
+			StringPoolSize = stringPoolSize,
+		};
+
+		int entriesSize = entries.Count * sizeof(TypeTableEntry);
+		int interfacesSize = interfaces.Count * sizeof(int);
+		var buffer = Marshal.AllocHGlobal(sizeof(TypeTableHeader) + entriesSize + interfacesSize + stringPoolSize);
+		var data = (byte*)buffer;
+
+		*(TypeTableHeader*)data = header;
+		data += sizeof(TypeTableHeader);
+
+		CopyTo(entries, data);
+		data += entriesSize;
+
+		CopyTo(interfaces, data);
+		data += interfacesSize;
+
+		var strings = new Span<byte>(data, stringPoolSize);
+
+		foreach (var name in names)
+			strings = strings[Encoding.UTF8.GetBytes(name, strings)..];
+
+		return buffer;
+	}
+
+	private static Type Register(Type InType, List<Type> InTypes, Dictionary<Type, int> InIndices)
+	{
+		if (InIndices.TryAdd(InType, InTypes.Count))
+			InTypes.Add(InType);
+
+		return InType;
+	}
+
+	// Same as GetTypeSize, except types that can't be marshalled report -1 instead of throwing.
+	// Classes only have a marshalled size if they specify their layout.
+	private static int GetSize(Type InType)
+	{
+		if (InType.ContainsGenericParameters || !(InType.IsValueType || InType.IsLayoutSequential || InType.IsExplicitLayout))
+			return -1;
+
+		try
+		{
+			return Marshal.SizeOf(InType);
+		}
+		catch (Exception)
+		{
+			return -1;
+		}
+	}
+
+	private static unsafe void CopyTo<T>(List<T> InList, byte* InDestination) where T : unmanaged
+	{
+		var source = CollectionsMarshal.AsSpan(InList);
+		source.CopyTo(new Span<T>(InDestination, source.Length));
+	}
+}
@@ -1,16 +1,42 @@
 ﻿using System;
 using System.Collections.Concurrent;
-using System.Runtime.CompilerServices;
+using System.Collections.Generic;
+using System.Threading;
 
 namespace Coral.Managed;
 
-public class UniqueIdList<T>
+// Hands out a dense, sequential ID per distinct object (compared by reference), adding the same object again returns its existing ID.
+// IDs index straight into a DenseIdList so resolving one is an array lookup, the reverse map is only used when adding.
+// ID 0 is never handed out, native code uses it to mean "no object" (e.g a type without a base type).
+public class UniqueIdList<T> where T : class
 {
-	private readonly ConcurrentDictionary<int, T> m_Objects = new();
+	// A range of IDs handed out before their objects exist, see Reserve
+	private sealed class Reservation
+	{
+		public readonly int FirstId;
+		public readonly int Count;
+		public readonly Func<int, T?> Resolve;
+		public readonly Func<T, int> IndexOf;
+
+		public Reservation(int InFirstId, int InCount, Func<int, T?> InResolve, Func<T, int> InIndexOf)
+		{
+			FirstId = InFirstId;
+			Count = InCount;
+			Resolve = InResolve;
+			IndexOf = InIndexOf;
+		}
+	}
+
+	private readonly DenseIdList<T> m_Objects = new(1);
+	private readonly ConcurrentDictionary<T, int> m_Ids = new(ReferenceEqualityComparer.Instance);
+	private readonly object m_Lock = new();
+
+	// Replaced instead of modified so TryGetValue can check for reservations without taking the lock
+	private Reservation[] m_Reservations = Array.Empty<Reservation>();
 
 	public bool Contains(int id)
 	{
-		return m_Objects.ContainsKey(id);
+		return TryGetValue(id, out _);
 	}
 
 	public int Add(T? obj)
@@ -20,18 +46,97 @@ public class UniqueIdList<T>
 			throw new ArgumentNullException(nameof(obj));
 		}
 
-		int hashCode = RuntimeHelpers.GetHashCode(obj);
-		_ = m_Objects.TryAdd(hashCode, obj);
-		return hashCode;
+		if (m_Ids.TryGetValue(obj, out int id))
+			return id;
+
+		lock (m_Lock)
+		{
+			if (m_Ids.TryGetValue(obj, out id))
+				return id;
+
+			// An object that belongs to a reservation has to get the ID that was handed out for it, not a second one
+			id = 0;
+			foreach (var reservation in m_Reservations)
+			{
+				int index = reservation.IndexOf(obj);
+
+				if (index >= 0 && index < reservation.Count)
+				{
+					id = reservation.FirstId + index;
+					m_Objects.Set(id, obj);
+					break;
+				}
+			}
+
+			if (id == 0)
+				id = m_Objects.Add(obj);
+
+			m_Ids.TryAdd(obj, id);
+			return id;
+		}
+	}
+
+	// Hands out InCount sequential IDs without creating their objects, which is what makes loading an assembly's types from
+	// native code's metadata cache cheap. InResolve(index) creates the object the first time its ID is looked up, and
+	// InIndexOf(object) returns the index an object was reserved under (or -1) so adding it directly doesn't give it a second ID.
+	// Returns the first ID.
+	public int Reserve(int InCount, Func<int, T?> InResolve, Func<T, int> InIndexOf)
+	{
+		lock (m_Lock)
+		{
+			int firstId = m_Objects.Reserve(InCount);
+			var reservations = new Reservation[m_Reservations.Length + 1];
+			m_Reservations.CopyTo(reservations, 0);
+			reservations[^1] = new Reservation(firstId, InCount, InResolve, InIndexOf);
+			Volatile.Write(ref m_Reservations, reservations);
+			return firstId;
+		}
 	}
 
 	public bool TryGetValue(int id, out T? obj)
 	{
-		return m_Objects.TryGetValue(id, out obj);
+		if (m_Objects.TryGetValue(id, out obj))
+			return true;
+
+		return Volatile.Read(ref m_Reservations).Length != 0 && TryResolveReserved(id, out obj);
+	}
+
+	private bool TryResolveReserved(int InId, out T? OutObject)
+	{
+		lock (m_Lock)
+		{
+			// Another thread may have resolved it while the lock wasn't held
+			if (m_Objects.TryGetValue(InId, out OutObject))
+				return true;
+
+			foreach (var reservation in m_Reservations)
+			{
+				int index = InId - reservation.FirstId;
+
+				if ((uint)index >= (uint)reservation.Count)
+					continue;
+
+				OutObject = reservation.Resolve(index);
+
+				if (OutObject == null)
+					return false;
+
+				m_Ids.TryAdd(OutObject, InId);
+				m_Objects.Set(InId, OutObject);
+				return true;
+			}
+
+			return false;
+		}
 	}
 
 	public void Clear()
 	{
-		m_Objects.Clear();
+		lock (m_Lock)
+		{
+			m_Ids.Clear();
+			m_Objects.Clear();
+			Volatile.Write(ref m_Reservations, Array.Empty<Reservation>());
+		}
 	}
 }
@@ -3,6 +3,7 @@
 #include "Type.hpp"
 
 #include "StableVector.hpp"
+#include "TypeNameMap.hpp"
 
 namespace Coral {
 
@@ -17,6 +18,8 @@ namespace Coral {
 	};
 
 	class HostInstance;
+	struct TypeTableHeader;
+	struct CachedMetadata;
 
 	class ManagedAssembly
 	{
@@ -28,10 +31,20 @@ namespace Coral {
 		void AddInternalCall(std::string_view InClassName, std::string_view InVariableName, void* InFunctionPtr);
 		void UploadInternalCalls();
 
+		// Returns a direct function pointer to a static method marked with [NativeCallable] and [UnmanagedCallersOnly], or nullptr if it couldn't be found.
+		// TSig is the native function type, e.g `GetFunctionPointer<int32_t(float, float)>("MyNamespace.MyType", "MyMethod")`
+		// NOTE: The pointer is invalidated when the owning AssemblyLoadContext is unloaded.
+		template<typename TSig>
+		TSig* GetFunctionPointer(std::string_view InClassName, std::string_view InMethodName) const
+		{
+			static_assert(std::is_function_v<TSig>, "TSig has to be a function type");
+			return reinterpret_cast<TSig*>(GetFunctionPointerInternal(InClassName, InMethodName));
+		}
+
 		[[deprecated(CORAL_GLOBAL_ALC_MSG)]]
-		Type& GetType(std::string_view InClassName) const;
+		Type& GetType(const TypeNameKey& InClassName) const;
 
-		Type& GetLocalType(std::string_view InClassName) const;
+		Type& GetLocalType(const TypeNameKey& InClassName) const;
 		Type& GetLocalType(TypeId InTypeId) const;
 
 		[[deprecated(CORAL_GLOBAL_ALC_MSG)]]
@@ -39,6 +52,13 @@ namespace Coral {
 
 		const std::vector<Type>& GetLocalTypes() const;
 
+	private:
+		void* GetFunctionPointerInternal(std::string_view InClassName, std::string_view InMethodName) const;
+
+		void LoadTypes() const;
+		void BuildTypes(const TypeTableHeader* InTable, TypeId InFirstLocalTypeId, const CachedMetadata* InCachedMetadata) const;
+		void EnsureTypesLoaded() const;
+
 	private:
 		HostInstance* m_Host = nullptr;
 		int32_t m_AssemblyId = -1;
@@ -50,12 +70,24 @@ namespace Coral {
 
 		std::vector<InternalCall> m_InternalCalls;
 
-		std::vector<Type*> m_Types;
+		// NOTE: Filled on load, or on first use if HostSettings::LazyTypeLoading is set, which is why they're mutable.
+		mutable std::vector<Type*> m_Types;
 
 		// NOTE(Emily): Doesn't need to be a `StableVector` since it's static post-init.
-		std::vector<Type> m_LocalTypes;
-		std::unordered_map<std::string, Type*> m_LocalTypeNameCache;
-		std::unordered_map<TypeId, Type*> m_LocalTypeIdCache;
+		mutable std::vector<Type> m_LocalTypes;
+		mutable TypeNameMap m_LocalTypeNameCache;
+		mutable std::unordered_map<TypeId, Type*> m_LocalTypeIdCache;
+
+		bool m_LazyTypes = false;
+		mutable bool m_TypesLoaded = false;
+
+		// Only set if the owning AssemblyLoadContext has a type table cache directory
+		std::string m_TypeTableCacheDirectory;
+		uint64_t m_ImageSize = 0;
+		uint64_t m_ImageHash = 0;
+
+		// Kept mapped while the types built from it can still enumerate their members from it
+		mutable std::shared_ptr<CachedMetadata> m_CachedMetadata;
 
 		friend class HostInstance;
 		friend class AssemblyLoadContext;
@@ -68,9 +100,15 @@ namespace Coral {
 		ManagedAssembly& LoadAssemblyFromMemory(const std::byte* data, int64_t dataLength);
 		const StableVector<ManagedAssembly>& GetLoadedAssemblies() const { return m_LoadedAssemblies; }
 
+		// Persist the type and member metadata of assemblies loaded into this context from now on in InDirectory (e.g C:\Dev\MyProject\Intermediates\Coral),
+		// an empty string disables the cache again. Later loads of the same build of an assembly map the cache file instead of reflecting over it,
+		// types are only loaded by the runtime once they're used and Type::GetMethods / GetFields are answered from the file.
+		void SetTypeTableCacheDirectory(std::string_view InDirectory);
+
 	private:
 		int32_t m_ContextId;
 		StableVector<ManagedAssembly> m_LoadedAssemblies;
+		std::string m_TypeTableCacheDirectory;
 
 		HostInstance* m_Host = nullptr;
 
@@ -2,6 +2,7 @@
 
 #include "Core.hpp"
 #include "String.hpp"
+#include "NameId.hpp"
 
 namespace Coral {
 
@@ -20,8 +21,17 @@ namespace Coral {
 			return result;
 		}
 
+		template<typename TReturn>
+		TReturn GetFieldValue(NameId InFieldName)
+		{
+			TReturn result;
+			GetFieldValueInternal(InFieldName, &result);
+			return result;
+		}
+
 	private:
 		void GetFieldValueInternal(std::string_view InFieldName, void* OutValue) const;
+		void GetFieldValueInternal(NameId InFieldName, void* OutValue) const;
 
 	private:
 		ManagedHandle m_Handle = -1;
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "MemberHandle.hpp"
+
+namespace Coral {
+
+	// A constructor that has already been resolved by signature, obtained through `Type::GetConstructor`.
+	// Creating objects through a handle calls a compiled factory directly.
+	class ConstructorHandle : public MemberHandle
+	{
+	private:
+		friend class Type;
+	};
+
+}
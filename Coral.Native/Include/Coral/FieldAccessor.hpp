@@ -0,0 +1,16 @@
+#pragma once
+
+#include "MemberHandle.hpp"
+
+namespace Coral {
+
+	// A field that has already been resolved by name, obtained through `Type::GetFieldAccessor`.
+	// Blittable, bool and string fields are read and written through compiled accessors rather than reflection.
+	class FieldAccessor : public MemberHandle
+	{
+	private:
+		friend class Type;
+		friend class ManagedObject;
+	};
+
+}
@@ -4,6 +4,7 @@
 #include "MessageLevel.hpp"
 #include "Assembly.hpp"
 #include "ManagedObject.hpp"
+#include "NameId.hpp"
 
 #include <functional>
 
@@ -22,6 +23,20 @@ namespace Coral {
 		MessageLevel MessageFilter = MessageLevel::All;
 
 		ExceptionCallbackFn ExceptionCallback = nullptr;
+
+		/// <summary>
+		/// Store managed objects in a slab owned by Coral.Managed instead of allocating a GCHandle for each of them.
+		/// Cheaper to create and destroy, and using a destroyed ManagedObject is detected instead of being undefined behaviour.
+		/// Turn it off to go back to raw GCHandles, which don't detect stale handles or free leftover objects when a context is unloaded.
+		/// </summary>
+		bool UseObjectHandleTable = true;
+
+		/// <summary>
+		/// Don't enumerate every type when an assembly is loaded. GetLocalType(name) resolves just the requested type,
+		/// the full list is only built the first time GetLocalTypes, GetTypes or GetLocalType(TypeId) needs it.
+		/// NOTE: The deprecated global lookups (ManagedAssembly::GetType, TypeCache::GetTypeByName) only see types that have already been resolved.
+		/// </summary>
+		bool LazyTypeLoading = false;
 	};
 
 	enum class CoralInitStatus
@@ -45,6 +60,10 @@ namespace Coral {
 		// This does not affect the behaviour of LoadAssembly from native code.
 		AssemblyLoadContext CreateAssemblyLoadContext(std::string_view InName, std::string_view InDllPath);
 
+		// Interns a method, field or property name so it can be passed to the NameId overloads without marshalling a string on every call.
+		// Interning the same name again returns the same NameId.
+		NameId InternName(std::string_view InName);
+
 	private:
 		bool LoadHostFXR() const;
 		bool InitializeCoralManaged();
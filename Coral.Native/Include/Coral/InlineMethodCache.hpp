@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Utility.hpp"
+#include "MethodHandle.hpp"
+
+#include <array>
+
+namespace Coral {
+
+	class Type;
+
+	// Remembers the methods resolved by a name-based InvokeMethod / InvokeStaticMethod call site, so repeated calls invoke through a
+	// MethodHandle instead of marshalling the name and looking the method up again. Pass one to the overloads that take a cache:
+	//   static thread_local Coral::InlineMethodCache s_UpdateCache;
+	//   object.InvokeMethod(s_UpdateCache, "OnUpdate", deltaTime);
+	// Entries are keyed by the receiver type, so a polymorphic call site keeps up to EntryCount receivers before it starts replacing them.
+	// Calls that don't pass a cache share a larger per-thread cache instead, where unrelated calls only evict each other if they hash to the same entry.
+	// NOTE: A cache isn't thread-safe, keep one per thread. All entries are invalidated when an AssemblyLoadContext is unloaded, since MethodHandles don't survive that.
+	class InlineMethodCache
+	{
+	public:
+		static constexpr size_t EntryCount = 4;
+
+		MethodHandle Find(const Type* InType, uint64_t InKey) const;
+		void Insert(const Type* InType, uint64_t InKey, MethodHandle InMethod);
+
+		// Identifies a method by its name and parameter types, so calls to different overloads never share an entry
+		static uint64_t GetKey(std::string_view InMethodName, const ManagedType* InParameterTypes, size_t InLength);
+
+		static void InvalidateAll();
+
+	private:
+		struct Entry
+		{
+			const Type* ReceiverType = nullptr;
+			uint64_t Key = 0;
+			MethodHandle Method;
+			uint32_t Epoch = 0;
+		};
+
+		std::array<Entry, EntryCount> m_Entries;
+		uint32_t m_NextEntry = 0;
+	};
+
+}
@@ -3,6 +3,13 @@
 #include "Core.hpp"
 #include "Utility.hpp"
 #include "String.hpp"
+#include "MethodHandle.hpp"
+#include "FieldAccessor.hpp"
+#include "PropertyAccessor.hpp"
+#include "NameId.hpp"
+#include "InlineMethodCache.hpp"
+
+#include <atomic>
 
 namespace Coral {
 
@@ -32,11 +39,11 @@ namespace Coral {
 				const void* parameterValues[parameterCount];
 				ManagedType parameterTypes[parameterCount];
 				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
-				InvokeMethodRetInternal(InMethodName, parameterValues, parameterTypes, parameterCount, &result);
+				InvokeMethodCachedInternal(nullptr, InMethodName, parameterValues, parameterTypes, parameterCount, &result);
 			}
 			else
 			{
-				InvokeMethodRetInternal(InMethodName, nullptr, nullptr, 0, &result);
+				InvokeMethodCachedInternal(nullptr, InMethodName, nullptr, nullptr, 0, &result);
 			}
 
 			return result;
@@ -52,11 +59,131 @@ namespace Coral {
 				const void* parameterValues[parameterCount];
 				ManagedType parameterTypes[parameterCount];
 				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
-				InvokeMethodInternal(InMethodName, parameterValues, parameterTypes, parameterCount);
+				InvokeMethodCachedInternal(nullptr, InMethodName, parameterValues, parameterTypes, parameterCount, nullptr);
+			}
+			else
+			{
+				InvokeMethodCachedInternal(nullptr, InMethodName, nullptr, nullptr, 0, nullptr);
+			}
+		}
+
+		template<typename TReturn, typename... TArgs>
+		TReturn InvokeMethod(InlineMethodCache& InCache, std::string_view InMethodName, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			TReturn result;
+			
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ManagedType parameterTypes[parameterCount];
+				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeMethodCachedInternal(&InCache, InMethodName, parameterValues, parameterTypes, parameterCount, &result);
+			}
+			else
+			{
+				InvokeMethodCachedInternal(&InCache, InMethodName, nullptr, nullptr, 0, &result);
+			}
+
+			return result;
+		}
+
+		template<typename... TArgs>
+		void InvokeMethod(InlineMethodCache& InCache, std::string_view InMethodName, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ManagedType parameterTypes[parameterCount];
+				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeMethodCachedInternal(&InCache, InMethodName, parameterValues, parameterTypes, parameterCount, nullptr);
+			}
+			else
+			{
+				InvokeMethodCachedInternal(&InCache, InMethodName, nullptr, nullptr, 0, nullptr);
+			}
+		}
+
+		template<typename TReturn, typename... TArgs>
+		TReturn InvokeMethod(const MethodHandle& InMethod, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			TReturn result;
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ManagedType parameterTypes[parameterCount];
+				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeMethodHandleInternal(InMethod, parameterValues, parameterCount, &result);
+			}
+			else
+			{
+				InvokeMethodHandleInternal(InMethod, nullptr, 0, &result);
+			}
+
+			return result;
+		}
+
+		template<typename... TArgs>
+		void InvokeMethod(const MethodHandle& InMethod, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ManagedType parameterTypes[parameterCount];
+				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeMethodHandleInternal(InMethod, parameterValues, parameterCount, nullptr);
+			}
+			else
+			{
+				InvokeMethodHandleInternal(InMethod, nullptr, 0, nullptr);
+			}
+		}
+
+		template<typename TReturn, typename... TArgs>
+		TReturn InvokeMethod(NameId InMethodName, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			TReturn result;
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ManagedType parameterTypes[parameterCount];
+				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeMethodInternal(InMethodName, parameterValues, parameterTypes, parameterCount, &result);
 			}
 			else
 			{
-				InvokeMethodInternal(InMethodName, nullptr, nullptr, 0);
+				InvokeMethodInternal(InMethodName, nullptr, nullptr, 0, &result);
+			}
+
+			return result;
+		}
+
+		template<typename... TArgs>
+		void InvokeMethod(NameId InMethodName, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ManagedType parameterTypes[parameterCount];
+				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeMethodInternal(InMethodName, parameterValues, parameterTypes, parameterCount, nullptr);
+			}
+			else
+			{
+				InvokeMethodInternal(InMethodName, nullptr, nullptr, 0, nullptr);
 			}
 		}
 
@@ -74,6 +201,20 @@ namespace Coral {
 			return result;
 		}
 
+		template<typename TValue>
+		void SetFieldValue(const FieldAccessor& InField, TValue InValue) const
+		{
+			SetFieldValueRaw(InField, &InValue);
+		}
+
+		template<typename TReturn>
+		TReturn GetFieldValue(const FieldAccessor& InField) const
+		{
+			TReturn result;
+			GetFieldValueRaw(InField, &result);
+			return result;
+		}
+
 		template<typename TValue>
 		void SetPropertyValue(std::string_view InPropertyName, TValue InValue) const
 		{
@@ -88,33 +229,100 @@ namespace Coral {
 			return result;
 		}
 
+		template<typename TValue>
+		void SetPropertyValue(const PropertyAccessor& InProperty, TValue InValue) const
+		{
+			SetPropertyValueRaw(InProperty, &InValue);
+		}
+
+		template<typename TReturn>
+		TReturn GetPropertyValue(const PropertyAccessor& InProperty) const
+		{
+			TReturn result;
+			GetPropertyValueRaw(InProperty, &result);
+			return result;
+		}
+
+		template<typename TValue>
+		void SetFieldValue(NameId InFieldName, TValue InValue) const
+		{
+			SetFieldValueRaw(InFieldName, &InValue);
+		}
+
+		template<typename TReturn>
+		TReturn GetFieldValue(NameId InFieldName) const
+		{
+			TReturn result;
+			GetFieldValueRaw(InFieldName, &result);
+			return result;
+		}
+
+		template<typename TValue>
+		void SetPropertyValue(NameId InPropertyName, TValue InValue) const
+		{
+			SetPropertyValueRaw(InPropertyName, &InValue);
+		}
+
+		template<typename TReturn>
+		TReturn GetPropertyValue(NameId InPropertyName) const
+		{
+			TReturn result;
+			GetPropertyValueRaw(InPropertyName, &result);
+			return result;
+		}
+
 		void SetFieldValueRaw(std::string_view InFieldName, void* InValue) const;
 		void GetFieldValueRaw(std::string_view InFieldName, void* OutValue) const;
+		void SetFieldValueRaw(const FieldAccessor& InField, void* InValue) const;
+		void GetFieldValueRaw(const FieldAccessor& InField, void* OutValue) const;
 		void SetPropertyValueRaw(std::string_view InPropertyName, void* InValue) const;
 		void GetPropertyValueRaw(std::string_view InPropertyName, void* OutValue) const;
+		void SetPropertyValueRaw(const PropertyAccessor& InProperty, void* InValue) const;
+		void GetPropertyValueRaw(const PropertyAccessor& InProperty, void* OutValue) const;
+		void SetFieldValueRaw(NameId InFieldName, void* InValue) const;
+		void GetFieldValueRaw(NameId InFieldName, void* OutValue) const;
+		void SetPropertyValueRaw(NameId InPropertyName, void* InValue) const;
+		void GetPropertyValueRaw(NameId InPropertyName, void* OutValue) const;
 
 		const Type& GetType();
 		
 		void Destroy();
 
+		// Destroys InCount objects in a single managed call, equivalent to calling `Destroy` on each of them.
+		static void DestroyBatch(ManagedObject* InObjects, size_t InCount);
+
 		bool IsValid() const { return m_Handle != nullptr && m_Type != nullptr; }
 
 	private:
 		void InvokeMethodInternal(std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const;
 		void InvokeMethodRetInternal(std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const;
+		void InvokeMethodHandleInternal(const MethodHandle& InMethod, const void** InParameters, size_t InLength, void* InResultStorage) const;
+		void InvokeMethodInternal(NameId InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const;
+		void InvokeMethodCachedInternal(InlineMethodCache* InCache, std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const;
+
+		// Drops this copy's reference, returns true if it was the last one and the handle should be freed
+		bool Release();
 
 	public:
 		alignas(8) void* m_Handle = nullptr;
 		alignas(8) const Type* m_Type = nullptr;
 
+		// Shared by every copy of this object, allocated the first time it's copied.
+		// Copies share m_Handle and only the last one to be destroyed frees it.
+		// Copying only has a const reference to the source, so the count is published with a compare exchange.
+		alignas(8) mutable std::atomic<std::atomic<uint32_t>*> m_RefCount = nullptr;
+
 	private:
 		friend class ManagedAssembly;
 		friend class Type;
+		friend class WeakManagedObject;
 	};
 
 	static_assert(offsetof(ManagedObject, m_Handle) == 0);
 	static_assert(offsetof(ManagedObject, m_Type) == 8);
-	static_assert(sizeof(ManagedObject) == 16);
+	static_assert(offsetof(ManagedObject, m_RefCount) == 16);
+	static_assert(std::is_standard_layout_v<ManagedObject>);
+	static_assert(sizeof(ManagedObject) == 24);
 
 	template<>
 	inline void ManagedObject::SetFieldValue(std::string_view InFieldName, std::string InValue) const
@@ -131,6 +339,21 @@ namespace Coral {
 		SetFieldValueRaw(InFieldName, &s);
 	}
 
+	template<>
+	inline void ManagedObject::SetFieldValue(const FieldAccessor& InField, std::string InValue) const
+	{
+		String s = String::New(InValue);
+		SetFieldValueRaw(InField, &s);
+		String::Free(s);
+	}
+
+	template<>
+	inline void ManagedObject::SetFieldValue(const FieldAccessor& InField, bool InValue) const
+	{
+		Bool32 s = InValue;
+		SetFieldValueRaw(InField, &s);
+	}
+
 	template<>
 	inline std::string ManagedObject::GetFieldValue(std::string_view InFieldName) const
 	{
@@ -149,5 +372,155 @@ namespace Coral {
 		return result;
 	}
 
+	template<>
+	inline std::string ManagedObject::GetFieldValue(const FieldAccessor& InField) const
+	{
+		String result;
+		GetFieldValueRaw(InField, &result);
+		auto s = result.Data() ? std::string(result) : "";
+		String::Free(result);
+		return s;
+	}
+
+	template<>
+	inline bool ManagedObject::GetFieldValue(const FieldAccessor& InField) const
+	{
+		Bool32 result;
+		GetFieldValueRaw(InField, &result);
+		return result;
+	}
+
+	template<>
+	inline void ManagedObject::SetFieldValue(NameId InFieldName, std::string InValue) const
+	{
+		String s = String::New(InValue);
+		SetFieldValueRaw(InFieldName, &s);
+		String::Free(s);
+	}
+
+	template<>
+	inline void ManagedObject::SetFieldValue(NameId InFieldName, bool InValue) const
+	{
+		Bool32 s = InValue;
+		SetFieldValueRaw(InFieldName, &s);
+	}
+
+	template<>
+	inline std::string ManagedObject::GetFieldValue(NameId InFieldName) const
+	{
+		String result;
+		GetFieldValueRaw(InFieldName, &result);
+		auto s = result.Data() ? std::string(result) : "";
+		String::Free(result);
+		return s;
+	}
+
+	template<>
+	inline bool ManagedObject::GetFieldValue(NameId InFieldName) const
+	{
+		Bool32 result;
+		GetFieldValueRaw(InFieldName, &result);
+		return result;
+	}
+
+	template<>
+	inline void ManagedObject::SetPropertyValue(std::string_view InPropertyName, std::string InValue) const
+	{
+		String s = String::New(InValue);
+		SetPropertyValueRaw(InPropertyName, &s);
+		String::Free(s);
+	}
+
+	template<>
+	inline void ManagedObject::SetPropertyValue(std::string_view InPropertyName, bool InValue) const
+	{
+		Bool32 s = InValue;
+		SetPropertyValueRaw(InPropertyName, &s);
+	}
+
+	template<>
+	inline std::string ManagedObject::GetPropertyValue(std::string_view InPropertyName) const
+	{
+		String result;
+		GetPropertyValueRaw(InPropertyName, &result);
+		auto s = result.Data() ? std::string(result) : "";
+		String::Free(result);
+		return s;
+	}
+
+	template<>
+	inline bool ManagedObject::GetPropertyValue(std::string_view InPropertyName) const
+	{
+		Bool32 result;
+		GetPropertyValueRaw(InPropertyName, &result);
+		return result;
+	}
+
+	template<>
+	inline void ManagedObject::SetPropertyValue(const PropertyAccessor& InProperty, std::string InValue) const
+	{
+		String s = String::New(InValue);
+		SetPropertyValueRaw(InProperty, &s);
+		String::Free(s);
+	}
+
+	template<>
+	inline void ManagedObject::SetPropertyValue(const PropertyAccessor& InProperty, bool InValue) const
+	{
+		Bool32 s = InValue;
+		SetPropertyValueRaw(InProperty, &s);
+	}
+
+	template<>
+	inline std::string ManagedObject::GetPropertyValue(const PropertyAccessor& InProperty) const
+	{
+		String result;
+		GetPropertyValueRaw(InProperty, &result);
+		auto s = result.Data() ? std::string(result) : "";
+		String::Free(result);
+		return s;
+	}
+
+	template<>
+	inline bool ManagedObject::GetPropertyValue(const PropertyAccessor& InProperty) const
+	{
+		Bool32 result;
+		GetPropertyValueRaw(InProperty, &result);
+		return result;
+	}
+
+	template<>
+	inline void ManagedObject::SetPropertyValue(NameId InPropertyName, std::string InValue) const
+	{
+		String s = String::New(InValue);
+		SetPropertyValueRaw(InPropertyName, &s);
+		String::Free(s);
+	}
+
+	template<>
+	inline void ManagedObject::SetPropertyValue(NameId InPropertyName, bool InValue) const
+	{
+		Bool32 s = InValue;
+		SetPropertyValueRaw(InPropertyName, &s);
+	}
+
+	template<>
+	inline std::string ManagedObject::GetPropertyValue(NameId InPropertyName) const
+	{
+		String result;
+		GetPropertyValueRaw(InPropertyName, &result);
+		auto s = result.Data() ? std::string(result) : "";
+		String::Free(result);
+		return s;
+	}
+
+	template<>
+	inline bool ManagedObject::GetPropertyValue(NameId InPropertyName) const
+	{
+		Bool32 result;
+		GetPropertyValueRaw(InPropertyName, &result);
+		return result;
+	}
+
 }
 
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace Coral {
+
+	// Base of the handles to members that have already been resolved (MethodHandle, ConstructorHandle, FieldAccessor and PropertyAccessor).
+	// Using a handle skips the name marshalling and lookup that the string-based APIs repeat on every call.
+	// NOTE: Unloading any AssemblyLoadContext invalidates every handle, not just the ones resolved from its types.
+	//		 Handle IDs are never reused, so using a stale handle is reported as an error instead of reaching a different member.
+	class MemberHandle
+	{
+	public:
+		bool IsValid() const { return m_Handle != -1; }
+		operator bool() const { return IsValid(); }
+
+		ManagedHandle GetHandle() const { return m_Handle; }
+
+	protected:
+		ManagedHandle m_Handle = -1;
+	};
+
+}
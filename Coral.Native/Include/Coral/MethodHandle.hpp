@@ -0,0 +1,15 @@
+#pragma once
+
+#include "MemberHandle.hpp"
+
+namespace Coral {
+
+	// A method that has already been resolved by name and signature, obtained through `Type::GetMethod`.
+	class MethodHandle : public MemberHandle
+	{
+	private:
+		friend class Type;
+		friend class ManagedObject;
+	};
+
+}
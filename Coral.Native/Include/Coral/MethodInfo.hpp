@@ -7,6 +7,7 @@ namespace Coral {
 
 	class Type;
 	class Attribute;
+	struct CachedMetadata;
 
 	class MethodInfo
 	{
@@ -21,10 +22,19 @@ namespace Coral {
 		std::vector<Attribute> GetAttributes() const;
 
 	private:
-		ManagedHandle m_Handle = -1;
+		// Methods enumerated from a metadata cache only ask the runtime for their handle once something needs it
+		ManagedHandle GetHandle() const;
+
+	private:
+		mutable ManagedHandle m_Handle = -1;
 		Type* m_ReturnType = nullptr;
 		std::vector<Type*> m_ParameterTypes;
 
+		// Only set if the method was enumerated from an assembly's metadata cache, which answers everything but GetAttributes
+		const CachedMetadata* m_CachedMetadata = nullptr;
+		int32_t m_CachedTypeIndex = -1;
+		int32_t m_CachedIndex = -1;
+
 		friend class Type;
 	};
 
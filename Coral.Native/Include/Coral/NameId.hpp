@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace Coral {
+
+	// A method, field or property name interned through `HostInstance::InternName`.
+	// Passing a NameId instead of a string skips allocating and transcoding the name on every call.
+	// NOTE: Names aren't tied to an AssemblyLoadContext, so a NameId stays valid across unloads.
+	class NameId
+	{
+	public:
+		bool IsValid() const { return m_Id != -1; }
+		operator bool() const { return IsValid(); }
+
+		int32_t GetId() const { return m_Id; }
+
+		bool operator==(const NameId& InOther) const { return m_Id == InOther.m_Id; }
+		bool operator!=(const NameId& InOther) const { return m_Id != InOther.m_Id; }
+
+	private:
+		int32_t m_Id = -1;
+
+		friend class HostInstance;
+		friend class ManagedObject;
+		friend class Type;
+		friend class Attribute;
+	};
+
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "MemberHandle.hpp"
+
+namespace Coral {
+
+	// A property that has already been resolved by name, obtained through `Type::GetPropertyAccessor`.
+	// The getter and setter are called through compiled delegates, so accessing a property costs about as much as a method call.
+	class PropertyAccessor : public MemberHandle
+	{
+	private:
+		friend class Type;
+		friend class ManagedObject;
+	};
+
+}
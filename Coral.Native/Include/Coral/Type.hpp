@@ -3,17 +3,29 @@
 #include "Core.hpp"
 #include "String.hpp"
 #include "ManagedObject.hpp"
+#include "WeakManagedObject.hpp"
 #include "MethodInfo.hpp"
 #include "FieldInfo.hpp"
 #include "PropertyInfo.hpp"
+#include "ConstructorHandle.hpp"
 
-#include <optional>
+#include <atomic>
 
 namespace Coral {
 
+	struct CachedMetadata;
+
 	class Type
 	{
 	public:
+		Type() = default;
+		Type(const Type& InOther);
+		Type(Type&& InOther) noexcept;
+		~Type();
+
+		Type& operator=(const Type& InOther);
+		Type& operator=(Type&& InOther) noexcept;
+
 		String GetFullName() const;
 		String GetAssemblyQualifiedName() const;
 
@@ -30,6 +42,50 @@ namespace Coral {
 		std::vector<FieldInfo> GetFields() const;
 		std::vector<PropertyInfo> GetProperties() const;
 
+		// Resolves a method once so it can be invoked repeatedly through `ManagedObject::InvokeMethod` or `InvokeStaticMethod`
+		// without any per-call name lookup. `TArgs` describes the parameter signature, e.g `GetMethod<float, int32_t>("Foo")`.
+		template<typename... TArgs>
+		MethodHandle GetMethod(std::string_view InMethodName) const
+		{
+			constexpr size_t parameterCount = sizeof...(TArgs);
+
+			if constexpr (parameterCount > 0)
+			{
+				ManagedType parameterTypes[parameterCount] = { Coral::GetManagedType<std::remove_const_t<std::remove_reference_t<TArgs>>>()... };
+				return GetMethodInternal(InMethodName, parameterTypes, parameterCount);
+			}
+			else
+			{
+				return GetMethodInternal(InMethodName, nullptr, 0);
+			}
+		}
+
+		// Resolves a constructor once so objects can be created through `CreateInstance(InConstructor, ...)` without any per-call lookup.
+		// `TArgs` describes the parameter signature, e.g `GetConstructor<float, int32_t>()`.
+		template<typename... TArgs>
+		ConstructorHandle GetConstructor() const
+		{
+			constexpr size_t parameterCount = sizeof...(TArgs);
+
+			if constexpr (parameterCount > 0)
+			{
+				ManagedType parameterTypes[parameterCount] = { Coral::GetManagedType<std::remove_const_t<std::remove_reference_t<TArgs>>>()... };
+				return GetConstructorInternal(parameterTypes, parameterCount);
+			}
+			else
+			{
+				return GetConstructorInternal(nullptr, 0);
+			}
+		}
+
+		// Resolves an instance field once so it can be read and written through `ManagedObject::GetFieldValue` / `SetFieldValue`
+		// without any per-call name lookup.
+		FieldAccessor GetFieldAccessor(std::string_view InFieldName) const;
+
+		// Resolves an instance property once so it can be read and written through `ManagedObject::GetPropertyValue` / `SetPropertyValue`
+		// without any per-call name lookup.
+		PropertyAccessor GetPropertyAccessor(std::string_view InPropertyName) const;
+
 		bool HasAttribute(const Type& InAttributeType) const;
 		std::vector<Attribute> GetAttributes() const;
 
@@ -67,6 +123,74 @@ namespace Coral {
 			return result;
 		}
 
+		// Creates an object that is only weakly referenced by native code, it will be collected unless something on the managed side keeps it alive.
+		template<typename... TArgs>
+		WeakManagedObject CreateInstanceWeak(TArgs&&... InArguments) const
+		{
+			constexpr size_t argumentCount = sizeof...(InArguments);
+
+			WeakManagedObject result;
+
+			if constexpr (argumentCount > 0)
+			{
+				const void* argumentsArr[argumentCount];
+				ManagedType argumentTypes[argumentCount];
+				AddToArray<TArgs...>(argumentsArr, argumentTypes, std::forward<TArgs>(InArguments)..., std::make_index_sequence<argumentCount> {});
+				result.m_Handle = CreateObjectInternal(true, argumentsArr, argumentTypes, argumentCount);
+			}
+			else
+			{
+				result.m_Handle = CreateObjectInternal(true, nullptr, nullptr, 0);
+			}
+
+			result.m_Type = result.m_Handle ? this : nullptr;
+			return result;
+		}
+
+		// Creates InCount objects in a single managed call, passing the same arguments to every constructor call.
+		// Any objects already stored in OutObjects are destroyed first.
+		// NOTE: InCount is limited to INT32_MAX, larger batches have to be split up.
+		template<typename... TArgs>
+		void CreateInstances(ManagedObject* OutObjects, size_t InCount, TArgs&&... InArguments) const
+		{
+			constexpr size_t argumentCount = sizeof...(InArguments);
+
+			if constexpr (argumentCount > 0)
+			{
+				const void* argumentsArr[argumentCount];
+				ManagedType argumentTypes[argumentCount];
+				AddToArray<TArgs...>(argumentsArr, argumentTypes, std::forward<TArgs>(InArguments)..., std::make_index_sequence<argumentCount> {});
+				CreateInstancesInternal(OutObjects, InCount, argumentsArr, argumentTypes, argumentCount);
+			}
+			else
+			{
+				CreateInstancesInternal(OutObjects, InCount, nullptr, nullptr, 0);
+			}
+		}
+
+		// NOTE: The handle is taken by value so that this overload is preferred over the one above for any kind of ConstructorHandle argument
+		template<typename... TArgs>
+		ManagedObject CreateInstance(ConstructorHandle InConstructor, TArgs&&... InArguments) const
+		{
+			constexpr size_t argumentCount = sizeof...(InArguments);
+
+			ManagedObject result;
+
+			if constexpr (argumentCount > 0)
+			{
+				const void* argumentsArr[argumentCount];
+				ManagedType argumentTypes[argumentCount];
+				AddToArray<TArgs...>(argumentsArr, argumentTypes, std::forward<TArgs>(InArguments)..., std::make_index_sequence<argumentCount> {});
+				result = CreateInstanceInternal(InConstructor, argumentsArr, argumentCount);
+			}
+			else
+			{
+				result = CreateInstanceInternal(InConstructor, nullptr, 0);
+			}
+
+			return result;
+		}
+
 		template <typename TReturn, typename... TArgs>
 		TReturn InvokeStaticMethod(std::string_view InMethodName, TArgs&&... InParameters) const
 		{
@@ -79,11 +203,11 @@ namespace Coral {
 				const void* parameterValues[parameterCount];
 				ManagedType parameterTypes[parameterCount];
 				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
-				InvokeStaticMethodRetInternal(InMethodName, parameterValues, parameterTypes, parameterCount, &result);
+				InvokeStaticMethodCachedInternal(nullptr, InMethodName, parameterValues, parameterTypes, parameterCount, &result);
 			}
 			else
 			{
-				InvokeStaticMethodRetInternal(InMethodName, nullptr, nullptr, 0, &result);
+				InvokeStaticMethodCachedInternal(nullptr, InMethodName, nullptr, nullptr, 0, &result);
 			}
 
 			return result;
@@ -99,24 +223,206 @@ namespace Coral {
 				const void* parameterValues[parameterCount];
 				ManagedType parameterTypes[parameterCount];
 				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
-				InvokeStaticMethodInternal(InMethodName, parameterValues, parameterTypes, parameterCount);
+				InvokeStaticMethodCachedInternal(nullptr, InMethodName, parameterValues, parameterTypes, parameterCount, nullptr);
+			}
+			else
+			{
+				InvokeStaticMethodCachedInternal(nullptr, InMethodName, nullptr, nullptr, 0, nullptr);
+			}
+		}
+
+		template <typename TReturn, typename... TArgs>
+		TReturn InvokeStaticMethod(InlineMethodCache& InCache, std::string_view InMethodName, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			TReturn result;
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ManagedType parameterTypes[parameterCount];
+				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeStaticMethodCachedInternal(&InCache, InMethodName, parameterValues, parameterTypes, parameterCount, &result);
 			}
 			else
 			{
-				InvokeStaticMethodInternal(InMethodName, nullptr, nullptr, 0);
+				InvokeStaticMethodCachedInternal(&InCache, InMethodName, nullptr, nullptr, 0, &result);
+			}
+
+			return result;
+		}
+
+		template <typename... TArgs>
+		void InvokeStaticMethod(InlineMethodCache& InCache, std::string_view InMethodName, TArgs&&... InParameters)
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ManagedType parameterTypes[parameterCount];
+				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeStaticMethodCachedInternal(&InCache, InMethodName, parameterValues, parameterTypes, parameterCount, nullptr);
+			}
+			else
+			{
+				InvokeStaticMethodCachedInternal(&InCache, InMethodName, nullptr, nullptr, 0, nullptr);
+			}
+		}
+
+		template <typename TReturn, typename... TArgs>
+		TReturn InvokeStaticMethod(NameId InMethodName, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			TReturn result;
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ManagedType parameterTypes[parameterCount];
+				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeStaticMethodInternal(InMethodName, parameterValues, parameterTypes, parameterCount, &result);
+			}
+			else
+			{
+				InvokeStaticMethodInternal(InMethodName, nullptr, nullptr, 0, &result);
+			}
+
+			return result;
+		}
+
+		template <typename... TArgs>
+		void InvokeStaticMethod(NameId InMethodName, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ManagedType parameterTypes[parameterCount];
+				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeStaticMethodInternal(InMethodName, parameterValues, parameterTypes, parameterCount, nullptr);
+			}
+			else
+			{
+				InvokeStaticMethodInternal(InMethodName, nullptr, nullptr, 0, nullptr);
+			}
+		}
+
+		template <typename TReturn, typename... TArgs>
+		TReturn InvokeStaticMethod(const MethodHandle& InMethod, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			TReturn result;
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ManagedType parameterTypes[parameterCount];
+				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeStaticMethodHandleInternal(InMethod, parameterValues, parameterCount, &result);
+			}
+			else
+			{
+				InvokeStaticMethodHandleInternal(InMethod, nullptr, 0, &result);
+			}
+
+			return result;
+		}
+
+		template <typename... TArgs>
+		void InvokeStaticMethod(const MethodHandle& InMethod, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ManagedType parameterTypes[parameterCount];
+				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeStaticMethodHandleInternal(InMethod, parameterValues, parameterCount, nullptr);
+			}
+			else
+			{
+				InvokeStaticMethodHandleInternal(InMethod, nullptr, 0, nullptr);
+			}
+		}
+
+		// Same as InvokeMethodBatch, but also collects the return values.
+		// OutResults has to point to storage for InCount results, result i belongs to InObjects[i].
+		template <typename TReturn, typename... TArgs>
+		void InvokeMethodBatchWithResults(const MethodHandle& InMethod, const ManagedObject* InObjects, size_t InCount, TReturn* OutResults, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ManagedType parameterTypes[parameterCount];
+				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeMethodBatchInternal(InMethod, InObjects, InCount, parameterValues, parameterCount, OutResults, sizeof(TReturn));
+			}
+			else
+			{
+				InvokeMethodBatchInternal(InMethod, InObjects, InCount, nullptr, 0, OutResults, sizeof(TReturn));
+			}
+		}
+
+		// Invokes InMethod on InCount objects in a single transition, passing the same parameters to every call.
+		// NOTE: InCount is limited to INT32_MAX, larger batches have to be split up.
+		template <typename... TArgs>
+		void InvokeMethodBatch(const MethodHandle& InMethod, const ManagedObject* InObjects, size_t InCount, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ManagedType parameterTypes[parameterCount];
+				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeMethodBatchInternal(InMethod, InObjects, InCount, parameterValues, parameterCount, nullptr, 0);
+			}
+			else
+			{
+				InvokeMethodBatchInternal(InMethod, InObjects, InCount, nullptr, 0, nullptr, 0);
 			}
 		}
 
 	private:
+		MethodHandle GetMethodInternal(std::string_view InMethodName, const ManagedType* InParameterTypes, size_t InLength) const;
+		void InvokeStaticMethodHandleInternal(const MethodHandle& InMethod, const void** InParameters, size_t InLength, void* InResultStorage) const;
+		void InvokeMethodBatchInternal(const MethodHandle& InMethod, const ManagedObject* InObjects, size_t InCount, const void** InParameters, size_t InLength, void* OutResults, size_t InResultStride) const;
+
 		ManagedObject CreateInstanceInternal(const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const;
+		void* CreateObjectInternal(bool InWeakRef, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const;
+		void CreateInstancesInternal(ManagedObject* OutObjects, size_t InCount, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const;
+		ConstructorHandle GetConstructorInternal(const ManagedType* InParameterTypes, size_t InLength) const;
+		ManagedObject CreateInstanceInternal(ConstructorHandle InConstructor, const void** InParameters, size_t InLength) const;
 		void InvokeStaticMethodInternal(std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const;
 		void InvokeStaticMethodRetInternal(std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const;
+		void InvokeStaticMethodInternal(NameId InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const;
+		void InvokeStaticMethodCachedInternal(InlineMethodCache* InCache, std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const;
 
 	private:
 		TypeId m_Id = -1;
-		Type* m_BaseType = nullptr;
-		std::optional<std::vector<Type*>> m_InterfaceTypes = std::nullopt;
-		Type* m_ElementType = nullptr;
+
+		// Resolved the first time they're asked for, possibly by several threads at once, so they're published atomically
+		std::atomic<Type*> m_BaseType = nullptr;
+		std::atomic<std::vector<Type*>*> m_InterfaceTypes = nullptr;
+		std::atomic<Type*> m_ElementType = nullptr;
+
+		// Filled in from the assembly's type table, types resolved any other way ask managed code every time
+		bool m_HasMetadata = false;
+		bool m_IsSZArray = false;
+		int32_t m_Size = -1;
+		ManagedType m_ManagedType = ManagedType::Unknown;
+
+		// Set for types built from an assembly's metadata cache, GetMethods and GetFields are answered from its tables
+		const CachedMetadata* m_CachedMetadata = nullptr;
+		int32_t m_CachedMetadataIndex = -1;
 
 		friend class HostInstance;
 		friend class ManagedAssembly;
@@ -2,6 +2,9 @@
 
 #include "Core.hpp"
 #include "StableVector.hpp"
+#include "TypeNameMap.hpp"
+
+#include <shared_mutex>
 
 namespace Coral {
 	class Type;
@@ -15,8 +18,12 @@ namespace Coral {
 		[[deprecated(CORAL_GLOBAL_ALC_MSG)]]
 		Type* CacheType(Type&& InType);
 
+		// Same as CacheType(Type&&) but doesn't have to ask managed code for the name
+		[[deprecated(CORAL_GLOBAL_ALC_MSG)]]
+		Type* CacheType(Type&& InType, std::string_view InFullName);
+
 		[[deprecated(CORAL_GLOBAL_ALC_MSG_P(ManagedAssembly::GetLocalType))]]
-		Type* GetTypeByName(std::string_view InName) const;
+		Type* GetTypeByName(const TypeNameKey& InName) const;
 
 		[[deprecated(CORAL_GLOBAL_ALC_MSG)]]
 		Type* GetTypeByID(TypeId InTypeID) const;
@@ -25,8 +32,11 @@ namespace Coral {
 		void Clear();
 
 	private:
+		// Lookups only take a shared lock so any number of threads can resolve types concurrently,
+		// CacheType takes it exclusively and returns the already cached type if the ID is known.
+		mutable std::shared_mutex m_Mutex;
 		StableVector<Type> m_Types;
-		std::unordered_map<std::string, Type*> m_NameCache;
+		TypeNameMap m_NameCache;
 		std::unordered_map<TypeId, Type*> m_IDCache;
 	};
 
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace Coral {
+
+	// A type's full name together with its hash, accepted anywhere a type is looked up by name.
+	// Declaring the key constexpr hashes a name that's known at compile time during compilation:
+	//   static constexpr Coral::TypeNameKey TestsTypeName("Testing.Managed.Tests");
+	//   auto& testsType = assembly.GetLocalType(TestsTypeName);
+	// NOTE: The key only views the name, it mustn't outlive the string it was created from.
+	class TypeNameKey
+	{
+	public:
+		constexpr TypeNameKey(const char* InName)
+			: TypeNameKey(std::string_view(InName)) {}
+
+		constexpr TypeNameKey(std::string_view InName)
+			: m_Name(InName), m_Hash(Hash(InName)) {}
+
+		TypeNameKey(const std::string& InName)
+			: TypeNameKey(std::string_view(InName)) {}
+
+		constexpr std::string_view GetName() const { return m_Name; }
+		constexpr uint64_t GetHash() const { return m_Hash; }
+
+		// 64-bit FNV-1a
+		static constexpr uint64_t Hash(std::string_view InName)
+		{
+			uint64_t hash = 0xCBF29CE484222325ull;
+
+			for (char c : InName)
+			{
+				hash ^= static_cast<uint8_t>(c);
+				hash *= 0x100000001B3ull;
+			}
+
+			return hash;
+		}
+
+	private:
+		std::string_view m_Name;
+		uint64_t m_Hash;
+	};
+
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Core.hpp"
+#include "TypeNameKey.hpp"
+
+#include <vector>
+
+namespace Coral {
+
+	class Type;
+
+	// Flat open addressing map from full type names to types, used for the name caches of ManagedAssembly and TypeCache.
+	// Lookups take a TypeNameKey so probing never allocates or rehashes the name, and every slot stores the name's hash
+	// so a probe only compares strings once the hashes match. The table is kept at most half full, which keeps probe
+	// sequences short, and sized once up front when an assembly's types are loaded since the set doesn't change afterwards.
+	// NOTE: Entries can't be removed individually, only by clearing the whole map.
+	class TypeNameMap
+	{
+	public:
+		Type* Find(const TypeNameKey& InKey) const;
+
+		// Maps the name to InType, replacing whichever type was previously stored under the same name
+		void InsertOrAssign(const TypeNameKey& InKey, Type* InType);
+
+		void Reserve(size_t InCount);
+		void Clear();
+
+		size_t GetSize() const { return m_Size; }
+
+	private:
+		struct Slot
+		{
+			uint64_t Hash = 0;
+			Type* Value = nullptr;
+			std::string Name;
+		};
+
+		// Returns the slot holding InKey, or the empty slot it would be inserted into
+		size_t FindSlot(const TypeNameKey& InKey) const;
+		void Rehash(size_t InCapacity);
+
+	private:
+		std::vector<Slot> m_Slots;
+		size_t m_Size = 0;
+	};
+
+}
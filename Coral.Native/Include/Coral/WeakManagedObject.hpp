@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Core.hpp"
+#include "ManagedObject.hpp"
+
+namespace Coral {
+
+	class Type;
+
+	// A weak reference to a managed object. Unlike ManagedObject it doesn't keep the object alive,
+	// so caching one on the native side won't prevent the GC from collecting the object.
+	class WeakManagedObject
+	{
+	public:
+		WeakManagedObject() = default;
+		explicit WeakManagedObject(const ManagedObject& InObject);
+		WeakManagedObject(const WeakManagedObject& InOther);
+		WeakManagedObject(WeakManagedObject&& InOther) noexcept;
+		~WeakManagedObject();
+
+		WeakManagedObject& operator=(const WeakManagedObject& InOther);
+		WeakManagedObject& operator=(WeakManagedObject&& InOther) noexcept;
+
+		// Returns a strong reference to the object if it's still alive, or an invalid ManagedObject if it has been collected.
+		ManagedObject TryLock() const;
+
+		bool IsAlive() const;
+
+		void Destroy();
+
+		bool IsValid() const { return m_Handle != nullptr && m_Type != nullptr; }
+
+	private:
+		void* m_Handle = nullptr;
+		const Type* m_Type = nullptr;
+
+		friend class Type;
+	};
+
+}
@@ -2,9 +2,14 @@
 #include "Coral/HostInstance.hpp"
 #include "Coral/StringHelper.hpp"
 #include "Coral/TypeCache.hpp"
+#include "Coral/Memory.hpp"
 
 #include "CoralManagedFunctions.hpp"
 #include "Verify.hpp"
+#include "TypeTable.hpp"
+#include "TypeTableCache.hpp"
+
+#include <shared_mutex>
 
 namespace Coral {
 
@@ -32,36 +37,252 @@ namespace Coral {
 		s_ManagedFunctions.SetInternalCallsFptr(m_OwnerContextId, m_InternalCalls.data(), static_cast<int32_t>(m_InternalCalls.size()));
 	}
 
+	void* ManagedAssembly::GetFunctionPointerInternal(std::string_view InClassName, std::string_view InMethodName) const
+	{
+		auto className = String::New(InClassName);
+		auto methodName = String::New(InMethodName);
+		void* functionPtr = s_ManagedFunctions.GetNativeCallableFunctionPointerFptr(m_OwnerContextId, m_AssemblyId, className, methodName);
+		String::Free(methodName);
+		String::Free(className);
+		return functionPtr;
+	}
+
 	static Type s_NullType;
 
-	Type& ManagedAssembly::GetType(std::string_view InClassName) const
+	// Guards the type caches of assemblies loaded with HostSettings::LazyTypeLoading, eagerly loaded assemblies never modify them after load.
+	static std::shared_mutex s_LazyTypeMutex;
+
+	Type& ManagedAssembly::GetType(const TypeNameKey& InClassName) const
 	{
 		Type* type = TypeCache::Get().GetTypeByName(InClassName);
 		return type != nullptr ? *type : s_NullType;
 	}
 
-	Type& ManagedAssembly::GetLocalType(std::string_view InClassName) const
+	Type& ManagedAssembly::GetLocalType(const TypeNameKey& InClassName) const
 	{
-		auto it = m_LocalTypeNameCache.find(std::string(InClassName));
-		return it == m_LocalTypeNameCache.end() ? s_NullType : *it->second;
+		if (!m_LazyTypes)
+		{
+			Type* type = m_LocalTypeNameCache.Find(InClassName);
+			return type != nullptr ? *type : s_NullType;
+		}
+
+		{
+			std::shared_lock lock(s_LazyTypeMutex);
+
+			if (Type* type = m_LocalTypeNameCache.Find(InClassName))
+				return *type;
+
+			if (m_TypesLoaded)
+				return s_NullType;
+		}
+
+		auto typeName = String::New(InClassName.GetName());
+		TypeId typeId = s_ManagedFunctions.GetAssemblyTypeFptr(m_OwnerContextId, m_AssemblyId, typeName);
+		String::Free(typeName);
+
+		if (typeId == 0)
+			return s_NullType;
+
+		std::unique_lock lock(s_LazyTypeMutex);
+
+		// Another thread may have resolved the same name while the lock wasn't held
+		if (Type* type = m_LocalTypeNameCache.Find(InClassName))
+			return *type;
+
+		// Types resolved one at a time live in the TypeCache, since m_LocalTypes can't grow without invalidating references.
+		// GetAssemblyType only accepts exact full names, so the requested name doubles as the cached one.
+		Type type;
+		type.m_Id = typeId;
+		Type* cached = TypeCache::Get().CacheType(std::move(type), InClassName.GetName());
+		m_LocalTypeNameCache.InsertOrAssign(InClassName, cached);
+		m_LocalTypeIdCache.try_emplace(typeId, cached);
+		return *cached;
 	}
 
 	Type& ManagedAssembly::GetLocalType(TypeId InClassId) const
 	{
+		if (m_LazyTypes)
+		{
+			EnsureTypesLoaded();
+
+			std::shared_lock lock(s_LazyTypeMutex);
+			auto it = m_LocalTypeIdCache.find(InClassId);
+			return it == m_LocalTypeIdCache.end() ? s_NullType : *it->second;
+		}
+
 		auto it = m_LocalTypeIdCache.find(InClassId);
 		return it == m_LocalTypeIdCache.end() ? s_NullType : *it->second;
 	}
 
 	const std::vector<Type*>& ManagedAssembly::GetTypes() const
 	{
+		EnsureTypesLoaded();
 		return m_Types;
 	}
 
 	const std::vector<Type>& ManagedAssembly::GetLocalTypes() const
 	{
+		EnsureTypesLoaded();
 		return m_LocalTypes;
 	}
 
+	void ManagedAssembly::LoadTypes() const
+	{
+		m_TypesLoaded = true;
+
+		TypeTableCacheKey cacheKey = {};
+		cacheKey.ImageSize = m_ImageSize;
+		cacheKey.ImageHash = m_ImageHash;
+
+		std::filesystem::path cacheFilePath;
+
+		if (!m_TypeTableCacheDirectory.empty() && s_ManagedFunctions.GetAssemblyModuleVersionIdFptr(m_OwnerContextId, m_AssemblyId, cacheKey.ModuleVersionId, cacheKey.CoreLibModuleVersionId))
+			cacheFilePath = TypeTableCache::GetFilePath(m_TypeTableCacheDirectory, m_Name, cacheKey);
+
+		if (!cacheFilePath.empty())
+		{
+			auto cachedMetadata = std::make_shared<CachedMetadata>(cacheFilePath);
+
+			// The runtime only hands out the type IDs here, it doesn't load a single type until one of them is used
+			if (TypeTableCache::Find(*cachedMetadata, cacheKey))
+			{
+				const auto* cachedTable = cachedMetadata->Types;
+				const auto* entries = reinterpret_cast<const TypeTableEntry*>(cachedTable + 1);
+
+				std::vector<int32_t> typeTokens(static_cast<size_t>(cachedTable->TypeCount));
+				for (int32_t i = 0; i < cachedTable->TypeCount; i++)
+					typeTokens[static_cast<size_t>(i)] = entries[i].Token;
+
+				if (TypeId firstTypeId = s_ManagedFunctions.ReserveAssemblyTypeIdsFptr(m_OwnerContextId, m_AssemblyId, typeTokens.data(), cachedTable->TypeCount); firstTypeId != 0)
+				{
+					cachedMetadata->LocalTypes = &m_LocalTypes;
+					BuildTypes(cachedTable, firstTypeId, cachedMetadata.get());
+					m_CachedMetadata = std::move(cachedMetadata);
+					return;
+				}
+			}
+		}
+
+		// One call returns everything needed to build the type table, so this doesn't have to call back into managed code per type
+		auto* table = static_cast<const TypeTableHeader*>(s_ManagedFunctions.GetAssemblyTypeTableFptr(m_OwnerContextId, m_AssemblyId));
+
+		if (table == nullptr)
+			return;
+
+		BuildTypes(table, 0, nullptr);
+
+		if (!cacheFilePath.empty())
+		{
+			// Only reflected over when the cache is written, this run keeps asking the runtime for members
+			if (auto* members = static_cast<const MemberTableHeader*>(s_ManagedFunctions.GetAssemblyMemberTableFptr(m_OwnerContextId, m_AssemblyId)))
+			{
+				TypeTableCache::Store(cacheFilePath, cacheKey, table, members);
+				Memory::FreeHGlobal(const_cast<MemberTableHeader*>(members));
+			}
+		}
+
+		Memory::FreeHGlobal(const_cast<TypeTableHeader*>(table));
+	}
+
+	void ManagedAssembly::BuildTypes(const TypeTableHeader* InTable, TypeId InFirstLocalTypeId, const CachedMetadata* InCachedMetadata) const
+	{
+		const auto* entries = reinterpret_cast<const TypeTableEntry*>(InTable + 1);
+		const auto* interfaceIds = reinterpret_cast<const TypeId*>(entries + InTable->EntryCount);
+		const auto* strings = reinterpret_cast<const char*>(interfaceIds + InTable->InterfaceCount);
+
+		// Tables loaded from the metadata cache refer to types by local reference, which were handed IDs in the same order
+		auto resolveTypeId = [InFirstLocalTypeId, InCachedMetadata](TypeId InTypeId)
+		{
+			return InCachedMetadata == nullptr || InTypeId == 0 ? InTypeId : InFirstLocalTypeId + InTypeId - 1;
+		};
+
+		auto makeType = [&resolveTypeId, InTable, InCachedMetadata](const TypeTableEntry& InEntry, int32_t InIndex)
+		{
+			Type type;
+			type.m_Id = resolveTypeId(InEntry.Id);
+			type.m_HasMetadata = true;
+			type.m_IsSZArray = InEntry.HasFlag(TypeTableFlags::IsSZArray);
+			type.m_Size = InEntry.Size;
+			type.m_ManagedType = InEntry.Type;
+
+			if (InCachedMetadata != nullptr && InIndex < InTable->TypeCount)
+			{
+				type.m_CachedMetadata = InCachedMetadata;
+				type.m_CachedMetadataIndex = InIndex;
+			}
+
+			return type;
+		};
+
+		// Cache external types as well so base types and interfaces can be linked up without resolving them by ID later
+		std::unordered_map<TypeId, Type*> cachedTypes;
+		cachedTypes.reserve(static_cast<size_t>(InTable->EntryCount));
+		for (int32_t i = 0; i < InTable->EntryCount; i++)
+		{
+			const auto& entry = entries[i];
+			std::string_view name(strings + entry.NameOffset, static_cast<size_t>(entry.NameLength));
+			Type* cached = TypeCache::Get().CacheType(makeType(entry, i), name);
+			cachedTypes[cached->GetTypeId()] = cached;
+
+			if (i < InTable->TypeCount)
+				m_Types.push_back(cached);
+		}
+
+		m_LocalTypes.reserve(static_cast<size_t>(InTable->TypeCount));
+		m_LocalTypeIdCache.reserve(static_cast<size_t>(InTable->TypeCount));
+		m_LocalTypeNameCache.Reserve(m_LocalTypeNameCache.GetSize() + static_cast<size_t>(InTable->TypeCount));
+		for (int32_t i = 0; i < InTable->TypeCount; i++)
+		{
+			const auto& entry = entries[i];
+
+			Type& inserted = m_LocalTypes.emplace_back(makeType(entry, i));
+
+			if (TypeId baseTypeId = resolveTypeId(entry.BaseTypeId); baseTypeId != 0)
+				inserted.m_BaseType.store(cachedTypes[baseTypeId], std::memory_order_relaxed);
+
+			std::vector<Type*> interfaceTypes;
+			interfaceTypes.reserve(static_cast<size_t>(entry.InterfaceCount));
+			for (int32_t j = 0; j < entry.InterfaceCount; j++)
+			{
+				TypeId interfaceId = resolveTypeId(interfaceIds[entry.FirstInterface + j]);
+
+				if (interfaceId == 0)
+					break;
+
+				interfaceTypes.push_back(cachedTypes[interfaceId]);
+			}
+
+			// The metadata cache doesn't store interfaces from other assemblies, those types ask the runtime on first use instead
+			if (interfaceTypes.size() == static_cast<size_t>(entry.InterfaceCount))
+				inserted.m_InterfaceTypes.store(new std::vector<Type*>(std::move(interfaceTypes)), std::memory_order_relaxed);
+
+			// Replaces any type that was resolved lazily, references returned before this point stay valid
+			m_LocalTypeIdCache[inserted.GetTypeId()] = &inserted;
+			m_LocalTypeNameCache.InsertOrAssign(std::string_view(strings + entry.NameOffset, static_cast<size_t>(entry.NameLength)), &inserted);
+		}
+	}
+
+	void ManagedAssembly::EnsureTypesLoaded() const
+	{
+		if (!m_LazyTypes)
+			return;
+
+		{
+			std::shared_lock lock(s_LazyTypeMutex);
+			if (m_TypesLoaded)
+				return;
+		}
+
+		std::unique_lock lock(s_LazyTypeMutex);
+		if (!m_TypesLoaded)
+			LoadTypes();
+	}
+
+	void AssemblyLoadContext::SetTypeTableCacheDirectory(std::string_view InDirectory)
+	{
+		m_TypeTableCacheDirectory = InDirectory;
+	}
+
 	// TODO(Emily): Massive de-dup needed between `LoadAssembly` and `LoadAssemblyFromMemory`.
 	ManagedAssembly& AssemblyLoadContext::LoadAssembly(std::string_view InFilePath)
 	{
@@ -72,6 +293,7 @@ namespace Coral {
 		result.m_AssemblyId = s_ManagedFunctions.LoadAssemblyFptr(m_ContextId, filepath);
 		result.m_OwnerContextId = m_ContextId;
 		result.m_LoadStatus = s_ManagedFunctions.GetLastLoadStatusFptr();
+		result.m_LazyTypes = m_Host->m_Settings.LazyTypeLoading;
 
 		if (result.m_LoadStatus == AssemblyLoadStatus::Success)
 		{
@@ -79,26 +301,20 @@ namespace Coral {
 			result.m_Name = assemblyName;
 			String::Free(assemblyName);
 
-			// TODO(Emily): Is it always desirable to preload every type from an assembly?
-			int32_t typeCount = 0;
-			s_ManagedFunctions.GetAssemblyTypesFptr(m_ContextId, result.m_AssemblyId, nullptr, &typeCount);
-
-			std::vector<TypeId> typeIds(static_cast<size_t>(typeCount));
-			s_ManagedFunctions.GetAssemblyTypesFptr(m_ContextId, result.m_AssemblyId, typeIds.data(), &typeCount);
-
-			result.m_LocalTypes.reserve(typeIds.size());
-			result.m_LocalTypeIdCache.reserve(typeIds.size());
-			result.m_LocalTypeNameCache.reserve(typeIds.size());
-			for (auto typeId : typeIds)
+			if (!m_TypeTableCacheDirectory.empty())
 			{
-				Type type;
-				type.m_Id = typeId;
-				result.m_Types.push_back(TypeCache::Get().CacheType(std::move(type)));
+				MappedFile image { std::filesystem::path(InFilePath) };
 
-				Type& inserted = result.m_LocalTypes.emplace_back(std::move(type));
-				result.m_LocalTypeIdCache[inserted.GetTypeId()] = &inserted;
-				result.m_LocalTypeNameCache[inserted.GetFullName()] = &inserted;
+				if (image.IsValid())
+				{
+					result.m_TypeTableCacheDirectory = m_TypeTableCacheDirectory;
+					result.m_ImageSize = image.GetSize();
+					result.m_ImageHash = TypeTableCacheKey::HashImage(image.GetData(), image.GetSize());
+				}
 			}
+
+			if (!result.m_LazyTypes)
+				result.LoadTypes();
 		}
 
 		String::Free(filepath);
@@ -111,7 +327,9 @@ namespace Coral {
 		auto [idx, result] = m_LoadedAssemblies.EmplaceBack();
 		result.m_Host = m_Host;
 		result.m_AssemblyId = s_ManagedFunctions.LoadAssemblyFromMemoryFptr(m_ContextId, data, dataLength);
+		result.m_OwnerContextId = m_ContextId;
 		result.m_LoadStatus = s_ManagedFunctions.GetLastLoadStatusFptr();
+		result.m_LazyTypes = m_Host->m_Settings.LazyTypeLoading;
 
 		if (result.m_LoadStatus == AssemblyLoadStatus::Success)
 		{
@@ -119,17 +337,15 @@ namespace Coral {
 			result.m_Name = assemblyName;
 			String::Free(assemblyName);
 
-			int32_t typeCount = 0;
-			s_ManagedFunctions.GetAssemblyTypesFptr(m_ContextId, result.m_AssemblyId, nullptr, &typeCount);
-			std::vector<TypeId> typeIds(static_cast<size_t>(typeCount));
-			s_ManagedFunctions.GetAssemblyTypesFptr(m_ContextId, result.m_AssemblyId, typeIds.data(), &typeCount);
-
-			for (auto typeId : typeIds)
+			if (!m_TypeTableCacheDirectory.empty())
 			{
-				Type type;
-				type.m_Id = typeId;
-				result.m_Types.push_back(TypeCache::Get().CacheType(std::move(type)));
+				result.m_TypeTableCacheDirectory = m_TypeTableCacheDirectory;
+				result.m_ImageSize = static_cast<uint64_t>(dataLength);
+				result.m_ImageHash = TypeTableCacheKey::HashImage(data, static_cast<size_t>(dataLength));
 			}
+
+			if (!result.m_LazyTypes)
+				result.LoadTypes();
 		}
 
 		return result;
@@ -35,6 +35,22 @@ namespace Coral {
 		return result;
 	}
 
+	template<>
+	std::string Attribute::GetFieldValue(NameId InFieldName)
+	{
+		String result;
+		GetFieldValueInternal(InFieldName, &result);
+		return std::string(result);
+	}
+
+	template<>
+	bool Attribute::GetFieldValue(NameId InFieldName)
+	{
+		Bool32 result;
+		GetFieldValueInternal(InFieldName, &result);
+		return result;
+	}
+
 	void Attribute::GetFieldValueInternal(std::string_view InFieldName, void* OutValue) const
 	{
 		auto fieldName = String::New(InFieldName);
@@ -42,4 +58,9 @@ namespace Coral {
 		String::Free(fieldName);
 	}
 
+	void Attribute::GetFieldValueInternal(NameId InFieldName, void* OutValue) const
+	{
+		s_ManagedFunctions.GetAttributeFieldValueByNameIdFptr(m_Handle, InFieldName.m_Id, OutValue);
+	}
+
 }
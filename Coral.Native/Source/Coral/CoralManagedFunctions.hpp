@@ -13,12 +13,14 @@ namespace Coral {
 	class ManagedField;
 
 	using SetInternalCallsFn = void (*)(int32_t, void*, int32_t);
+	using GetNativeCallableFunctionPointerFn = void* (*)(int32_t, int32_t, String, String);
 	using CreateAssemblyLoadContextFn = int32_t (*)(String, String);
 	using UnloadAssemblyLoadContextFn = void (*)(int32_t);
 	using LoadAssemblyFn = int32_t(*)(int32_t, String);
 	using LoadAssemblyFromMemoryFn = int32_t(*)(int32_t, const std::byte*, int64_t);
 	using GetLastLoadStatusFn = AssemblyLoadStatus (*)();
 	using GetAssemblyNameFn = String (*)(int32_t, int32_t);
+	using InternNameFn = int32_t (*)(String);
 
 #pragma region DotnetServices
 	using RunMSBuildFn = void(*)(String, Bool32, Bool32*);
@@ -27,6 +29,13 @@ namespace Coral {
 #pragma region TypeInterface
 
 	using GetAssemblyTypesFn = void (*)(int32_t, int32_t, TypeId*, int32_t*);
+	using GetAssemblyTypeFn = TypeId (*)(int32_t, int32_t, String);
+	using GetAssemblyTypeTableFn = void* (*)(int32_t, int32_t);
+	using GetAssemblyModuleVersionIdFn = Bool32 (*)(int32_t, int32_t, uint8_t*, uint8_t*);
+	using ReserveAssemblyTypeIdsFn = TypeId (*)(int32_t, int32_t, const int32_t*, int32_t);
+	using GetAssemblyMemberTableFn = void* (*)(int32_t, int32_t);
+	using ResolveTypeMethodFn = ManagedHandle (*)(TypeId, int32_t, int32_t, String);
+	using ResolveTypeFieldFn = ManagedHandle (*)(TypeId, int32_t, int32_t, String);
 	using GetTypeIdFn = void (*)(String, TypeId*);
 	using GetFullTypeNameFn = String (*)(TypeId);
 	using GetAssemblyQualifiedNameFn = String (*)(TypeId);
@@ -71,20 +80,43 @@ namespace Coral {
 
 #pragma region Attribute
 	using GetAttributeFieldValueFn = void (*)(ManagedHandle, String, void*);
+	using GetAttributeFieldValueByNameIdFn = void (*)(ManagedHandle, int32_t, void*);
 	using GetAttributeTypeFn = void (*)(ManagedHandle, TypeId*);
 #pragma endregion
 
 	using CreateObjectFn = void* (*)(TypeId, Bool32, const void**, const ManagedType*, int32_t);
-	using CopyObjectFn = void* (*)(void*);
+	using CreateObjectsFn = void (*)(TypeId, Bool32, const void**, const ManagedType*, int32_t, void*, int32_t, int32_t);
+	using ResolveConstructorFn = ManagedHandle(*)(TypeId, const ManagedType*, int32_t);
+	using CreateObjectFromConstructorFn = void* (*)(ManagedHandle, Bool32, const void**, int32_t);
 	using InvokeMethodFn = void (*)(void*, String, const void**, const ManagedType*, int32_t);
 	using InvokeMethodRetFn = void (*)(void*, String, const void**, const ManagedType*, int32_t, void*);
 	using InvokeStaticMethodFn = void (*)(TypeId, String, const void**, const ManagedType*, int32_t);
 	using InvokeStaticMethodRetFn = void (*)(TypeId, String, const void**, const ManagedType*, int32_t, void*);
+	using InvokeStaticMethodByNameIdFn = void (*)(TypeId, int32_t, const void**, const ManagedType*, int32_t, void*);
+	using InvokeMethodByNameIdFn = void (*)(void*, int32_t, const void**, const ManagedType*, int32_t, void*);
+	using ResolveMethodFn = ManagedHandle (*)(TypeId, String, const ManagedType*, int32_t);
+	using InvokeMethodHandleFn = void (*)(void*, ManagedHandle, const void**, int32_t, void*);
+	using InvokeStaticMethodHandleFn = void (*)(ManagedHandle, const void**, int32_t, void*);
+	using InvokeMethodHandleBatchFn = void(*)(const void*, int32_t, int32_t, ManagedHandle, const void**, int32_t, void*, int32_t);
+	using ResolveFieldAccessorFn = ManagedHandle(*)(TypeId, String);
+	using SetFieldAccessorValueFn = void(*)(void*, ManagedHandle, void*);
+	using GetFieldAccessorValueFn = void(*)(void*, ManagedHandle, void*);
+	using ResolvePropertyAccessorFn = ManagedHandle(*)(TypeId, String);
+	using SetPropertyAccessorValueFn = void(*)(void*, ManagedHandle, void*);
+	using GetPropertyAccessorValueFn = void(*)(void*, ManagedHandle, void*);
 	using SetFieldValueFn = void (*)(void*, String, void*);
 	using GetFieldValueFn = void (*)(void*, String, void*);
 	using SetPropertyValueFn = void (*)(void*, String, void*);
 	using GetPropertyValueFn = void (*)(void*, String, void*);
+	using SetFieldValueByNameIdFn = void (*)(void*, int32_t, void*);
+	using GetFieldValueByNameIdFn = void (*)(void*, int32_t, void*);
+	using SetPropertyValueByNameIdFn = void (*)(void*, int32_t, void*);
+	using GetPropertyValueByNameIdFn = void (*)(void*, int32_t, void*);
 	using DestroyObjectFn = void (*)(void*);
+	using DestroyObjectsFn = void (*)(void*, int32_t, int32_t);
+	using CreateWeakReferenceFn = void* (*)(void*);
+	using LockWeakReferenceFn = void* (*)(void*);
+	using IsWeakReferenceAliveFn = Bool32 (*)(void*);
 	using GetObjectTypeIdFn = void (*)(void*, int32_t*);
 
 	using CollectGarbageFn = void (*)(int32_t, GCCollectionMode, Bool32, Bool32);
@@ -93,11 +125,13 @@ namespace Coral {
 	struct ManagedFunctions
 	{
 		SetInternalCallsFn SetInternalCallsFptr = nullptr;
+		GetNativeCallableFunctionPointerFn GetNativeCallableFunctionPointerFptr = nullptr;
 		LoadAssemblyFn LoadAssemblyFptr = nullptr;
 		LoadAssemblyFromMemoryFn LoadAssemblyFromMemoryFptr = nullptr;
 		UnloadAssemblyLoadContextFn UnloadAssemblyLoadContextFptr = nullptr;
 		GetLastLoadStatusFn GetLastLoadStatusFptr = nullptr;
 		GetAssemblyNameFn GetAssemblyNameFptr = nullptr;
+		InternNameFn InternNameFptr = nullptr;
 
 #pragma region DotnetServices
 		RunMSBuildFn RunMSBuildFptr = nullptr;
@@ -106,6 +140,13 @@ namespace Coral {
 #pragma region TypeInterface
 
 		GetAssemblyTypesFn GetAssemblyTypesFptr = nullptr;
+		GetAssemblyTypeFn GetAssemblyTypeFptr = nullptr;
+		GetAssemblyTypeTableFn GetAssemblyTypeTableFptr = nullptr;
+		GetAssemblyModuleVersionIdFn GetAssemblyModuleVersionIdFptr = nullptr;
+		ReserveAssemblyTypeIdsFn ReserveAssemblyTypeIdsFptr = nullptr;
+		GetAssemblyMemberTableFn GetAssemblyMemberTableFptr = nullptr;
+		ResolveTypeMethodFn ResolveTypeMethodFptr = nullptr;
+		ResolveTypeFieldFn ResolveTypeFieldFptr = nullptr;
 		GetFullTypeNameFn GetFullTypeNameFptr = nullptr;
 		GetAssemblyQualifiedNameFn GetAssemblyQualifiedNameFptr = nullptr;
 		GetBaseTypeFn GetBaseTypeFptr = nullptr;
@@ -149,21 +190,44 @@ namespace Coral {
 
 #pragma region Attribute
 		GetAttributeFieldValueFn GetAttributeFieldValueFptr = nullptr;
+		GetAttributeFieldValueByNameIdFn GetAttributeFieldValueByNameIdFptr = nullptr;
 		GetAttributeTypeFn GetAttributeTypeFptr = nullptr;
 #pragma endregion
 
 		CreateObjectFn CreateObjectFptr = nullptr;
-		CopyObjectFn CopyObjectFptr = nullptr;
+		CreateObjectsFn CreateObjectsFptr = nullptr;
+		ResolveConstructorFn ResolveConstructorFptr = nullptr;
+		CreateObjectFromConstructorFn CreateObjectFromConstructorFptr = nullptr;
 		CreateAssemblyLoadContextFn CreateAssemblyLoadContextFptr = nullptr;
 		InvokeMethodFn InvokeMethodFptr = nullptr;
 		InvokeMethodRetFn InvokeMethodRetFptr = nullptr;
 		InvokeStaticMethodFn InvokeStaticMethodFptr = nullptr;
 		InvokeStaticMethodRetFn InvokeStaticMethodRetFptr = nullptr;
+		InvokeStaticMethodByNameIdFn InvokeStaticMethodByNameIdFptr = nullptr;
+		InvokeMethodByNameIdFn InvokeMethodByNameIdFptr = nullptr;
+		ResolveMethodFn ResolveMethodFptr = nullptr;
+		InvokeMethodHandleFn InvokeMethodHandleFptr = nullptr;
+		InvokeStaticMethodHandleFn InvokeStaticMethodHandleFptr = nullptr;
+		InvokeMethodHandleBatchFn InvokeMethodHandleBatchFptr = nullptr;
+		ResolveFieldAccessorFn ResolveFieldAccessorFptr = nullptr;
+		SetFieldAccessorValueFn SetFieldAccessorValueFptr = nullptr;
+		GetFieldAccessorValueFn GetFieldAccessorValueFptr = nullptr;
+		ResolvePropertyAccessorFn ResolvePropertyAccessorFptr = nullptr;
+		SetPropertyAccessorValueFn SetPropertyAccessorValueFptr = nullptr;
+		GetPropertyAccessorValueFn GetPropertyAccessorValueFptr = nullptr;
 		SetFieldValueFn SetFieldValueFptr = nullptr;
 		GetFieldValueFn GetFieldValueFptr = nullptr;
 		SetPropertyValueFn SetPropertyValueFptr = nullptr;
 		GetPropertyValueFn GetPropertyValueFptr = nullptr;
+		SetFieldValueByNameIdFn SetFieldValueByNameIdFptr = nullptr;
+		GetFieldValueByNameIdFn GetFieldValueByNameIdFptr = nullptr;
+		SetPropertyValueByNameIdFn SetPropertyValueByNameIdFptr = nullptr;
+		GetPropertyValueByNameIdFn GetPropertyValueByNameIdFptr = nullptr;
 		DestroyObjectFn DestroyObjectFptr = nullptr;
+		DestroyObjectsFn DestroyObjectsFptr = nullptr;
+		CreateWeakReferenceFn CreateWeakReferenceFptr = nullptr;
+		LockWeakReferenceFn LockWeakReferenceFptr = nullptr;
+		IsWeakReferenceAliveFn IsWeakReferenceAliveFptr = nullptr;
 		GetObjectTypeIdFn GetObjectTypeIdFptr = nullptr;
 
 		CollectGarbageFn CollectGarbageFptr = nullptr;
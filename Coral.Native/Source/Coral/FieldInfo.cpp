@@ -4,20 +4,50 @@
 #include "Coral/TypeCache.hpp"
 
 #include "CoralManagedFunctions.hpp"
+#include "TypeTableCache.hpp"
 
 namespace Coral {
 
+	static const MemberTableField& GetCachedField(const CachedMetadata& InMetadata, int32_t InTypeIndex, int32_t InIndex)
+	{
+		return InMetadata.Fields[InMetadata.TypeMembers[InTypeIndex].FirstField + InIndex];
+	}
+
+	ManagedHandle FieldInfo::GetHandle() const
+	{
+		if (m_Handle == -1 && m_CachedMetadata != nullptr)
+		{
+			const auto& field = GetCachedField(*m_CachedMetadata, m_CachedTypeIndex, m_CachedIndex);
+			TypeId typeId = m_CachedMetadata->GetLocalType(m_CachedTypeIndex + 1)->GetTypeId();
+
+			auto name = String::New(m_CachedMetadata->GetMemberName(field.NameOffset, field.NameLength));
+			m_Handle = s_ManagedFunctions.ResolveTypeFieldFptr(typeId, m_CachedIndex, field.Token, name);
+			String::Free(name);
+		}
+
+		return m_Handle;
+	}
+
 	String FieldInfo::GetName() const
 	{
+		if (m_CachedMetadata != nullptr)
+		{
+			const auto& field = GetCachedField(*m_CachedMetadata, m_CachedTypeIndex, m_CachedIndex);
+			return String::New(m_CachedMetadata->GetMemberName(field.NameOffset, field.NameLength));
+		}
+
 		return s_ManagedFunctions.GetFieldInfoNameFptr(m_Handle);
 	}
 
 	Type& FieldInfo::GetType()
 	{
+		if (!m_Type && m_CachedMetadata != nullptr)
+			m_Type = m_CachedMetadata->GetLocalType(GetCachedField(*m_CachedMetadata, m_CachedTypeIndex, m_CachedIndex).FieldType);
+
 		if (!m_Type)
 		{
 			Type fieldType;
-			s_ManagedFunctions.GetFieldInfoTypeFptr(m_Handle, &fieldType.m_Id);
+			s_ManagedFunctions.GetFieldInfoTypeFptr(GetHandle(), &fieldType.m_Id);
 			m_Type = TypeCache::Get().CacheType(std::move(fieldType));
 		}
 
@@ -26,15 +56,18 @@ namespace Coral {
 
 	TypeAccessibility FieldInfo::GetAccessibility() const
 	{
+		if (m_CachedMetadata != nullptr)
+			return GetCachedField(*m_CachedMetadata, m_CachedTypeIndex, m_CachedIndex).Accessibility;
+
 		return s_ManagedFunctions.GetFieldInfoAccessibilityFptr(m_Handle);
 	}
 
 	std::vector<Attribute> FieldInfo::GetAttributes() const
 	{
 		int32_t attributeCount;
-		s_ManagedFunctions.GetFieldInfoAttributesFptr(m_Handle, nullptr, &attributeCount);
+		s_ManagedFunctions.GetFieldInfoAttributesFptr(GetHandle(), nullptr, &attributeCount);
 		std::vector<ManagedHandle> attributeHandles(static_cast<size_t>(attributeCount));
-		s_ManagedFunctions.GetFieldInfoAttributesFptr(m_Handle, attributeHandles.data(), &attributeCount);
+		s_ManagedFunctions.GetFieldInfoAttributesFptr(GetHandle(), attributeHandles.data(), &attributeCount);
 
 		std::vector<Attribute> result(attributeHandles.size());
 		for (size_t i = 0; i < attributeHandles.size(); i++)
@@ -121,9 +121,19 @@ namespace Coral {
 	{
 		s_ManagedFunctions.UnloadAssemblyLoadContextFptr(InLoadContext.m_ContextId);
 		InLoadContext.m_ContextId = -1;
+		InlineMethodCache::InvalidateAll();
 		InLoadContext.m_LoadedAssemblies.Clear();
 	}
 
+	NameId HostInstance::InternName(std::string_view InName)
+	{
+		auto name = String::New(InName);
+		NameId result;
+		result.m_Id = s_ManagedFunctions.InternNameFptr(name);
+		String::Free(name);
+		return result;
+	}
+
 #ifdef CORAL_WINDOWS
 	template <typename TFunc>
 	TFunc LoadFunctionPtr(void* InLibraryHandle, const char* InFunctionName)
@@ -267,7 +277,7 @@ namespace Coral {
 			CORAL_VERIFY(status == StatusCode::Success);
 		}
 
-		using InitializeFn = void(*)(void(*)(String, MessageLevel), void(*)(String));
+		using InitializeFn = void(*)(void(*)(String, MessageLevel), void(*)(String), Bool32);
 		InitializeFn coralManagedEntryPoint = nullptr;
 		coralManagedEntryPoint = LoadCoralManagedFunctionPtr<InitializeFn>(CORAL_STR("Coral.Managed.ManagedHost, Coral.Managed"), CORAL_STR("Initialize"));
 
@@ -291,7 +301,7 @@ namespace Coral {
 			}
 			
 			ExceptionCallback(message);
-		});
+		}, m_Settings.UseObjectHandleTable);
 
 		ExceptionCallback = m_Settings.ExceptionCallback;
 
@@ -311,6 +321,13 @@ namespace Coral {
 		s_ManagedFunctions.RunMSBuildFptr = LoadCoralManagedFunctionPtr<RunMSBuildFn>(CORAL_STR("Coral.Managed.MSBuildRunner, Coral.Managed"), CORAL_STR("Run"));
 
 		s_ManagedFunctions.GetAssemblyTypesFptr = LoadCoralManagedFunctionPtr<GetAssemblyTypesFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("GetAssemblyTypes"));
+		s_ManagedFunctions.GetAssemblyTypeFptr = LoadCoralManagedFunctionPtr<GetAssemblyTypeFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("GetAssemblyType"));
+		s_ManagedFunctions.GetAssemblyTypeTableFptr = LoadCoralManagedFunctionPtr<GetAssemblyTypeTableFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("GetAssemblyTypeTable"));
+		s_ManagedFunctions.GetAssemblyModuleVersionIdFptr = LoadCoralManagedFunctionPtr<GetAssemblyModuleVersionIdFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("GetAssemblyModuleVersionId"));
+		s_ManagedFunctions.ReserveAssemblyTypeIdsFptr = LoadCoralManagedFunctionPtr<ReserveAssemblyTypeIdsFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("ReserveAssemblyTypeIds"));
+		s_ManagedFunctions.GetAssemblyMemberTableFptr = LoadCoralManagedFunctionPtr<GetAssemblyMemberTableFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("GetAssemblyMemberTable"));
+		s_ManagedFunctions.ResolveTypeMethodFptr = LoadCoralManagedFunctionPtr<ResolveTypeMethodFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("ResolveTypeMethod"));
+		s_ManagedFunctions.ResolveTypeFieldFptr = LoadCoralManagedFunctionPtr<ResolveTypeFieldFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("ResolveTypeField"));
 		s_ManagedFunctions.GetFullTypeNameFptr = LoadCoralManagedFunctionPtr<GetFullTypeNameFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("GetFullTypeName"));
 		s_ManagedFunctions.GetAssemblyQualifiedNameFptr = LoadCoralManagedFunctionPtr<GetAssemblyQualifiedNameFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("GetAssemblyQualifiedName"));
 		s_ManagedFunctions.GetBaseTypeFptr = LoadCoralManagedFunctionPtr<GetBaseTypeFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("GetBaseType"));
@@ -347,18 +364,43 @@ namespace Coral {
 		s_ManagedFunctions.GetPropertyInfoAttributesFptr = LoadCoralManagedFunctionPtr<GetPropertyInfoAttributesFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("GetPropertyInfoAttributes"));
 
 		s_ManagedFunctions.GetAttributeFieldValueFptr = LoadCoralManagedFunctionPtr<GetAttributeFieldValueFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("GetAttributeFieldValue"));
+		s_ManagedFunctions.GetAttributeFieldValueByNameIdFptr = LoadCoralManagedFunctionPtr<GetAttributeFieldValueByNameIdFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("GetAttributeFieldValueByNameId"));
 		s_ManagedFunctions.GetAttributeTypeFptr = LoadCoralManagedFunctionPtr<GetAttributeTypeFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("GetAttributeType"));
 
 		s_ManagedFunctions.SetInternalCallsFptr = LoadCoralManagedFunctionPtr<SetInternalCallsFn>(CORAL_STR("Coral.Managed.Interop.InternalCallsManager, Coral.Managed"), CORAL_STR("SetInternalCalls"));
+		s_ManagedFunctions.InternNameFptr = LoadCoralManagedFunctionPtr<InternNameFn>(CORAL_STR("Coral.Managed.NameTable, Coral.Managed"), CORAL_STR("InternName"));
+		s_ManagedFunctions.GetNativeCallableFunctionPointerFptr = LoadCoralManagedFunctionPtr<GetNativeCallableFunctionPointerFn>(CORAL_STR("Coral.Managed.Interop.InternalCallsManager, Coral.Managed"), CORAL_STR("GetNativeCallableFunctionPointer"));
 		s_ManagedFunctions.CreateObjectFptr = LoadCoralManagedFunctionPtr<CreateObjectFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("CreateObject"));
-		s_ManagedFunctions.CopyObjectFptr = LoadCoralManagedFunctionPtr<CopyObjectFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("CopyObject"));
+		s_ManagedFunctions.CreateObjectsFptr = LoadCoralManagedFunctionPtr<CreateObjectsFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("CreateObjects"));
+		s_ManagedFunctions.ResolveConstructorFptr = LoadCoralManagedFunctionPtr<ResolveConstructorFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("ResolveConstructor"));
+		s_ManagedFunctions.CreateObjectFromConstructorFptr = LoadCoralManagedFunctionPtr<CreateObjectFromConstructorFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("CreateObjectFromConstructor"));
 		s_ManagedFunctions.InvokeMethodFptr = LoadCoralManagedFunctionPtr<InvokeMethodFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("InvokeMethod"));
 		s_ManagedFunctions.InvokeMethodRetFptr = LoadCoralManagedFunctionPtr<InvokeMethodRetFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("InvokeMethodRet"));
+		s_ManagedFunctions.ResolveMethodFptr = LoadCoralManagedFunctionPtr<ResolveMethodFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("ResolveMethod"));
+		s_ManagedFunctions.InvokeMethodHandleFptr = LoadCoralManagedFunctionPtr<InvokeMethodHandleFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("InvokeMethodHandle"));
+		s_ManagedFunctions.InvokeStaticMethodHandleFptr = LoadCoralManagedFunctionPtr<InvokeStaticMethodHandleFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("InvokeStaticMethodHandle"));
+		s_ManagedFunctions.InvokeMethodHandleBatchFptr = LoadCoralManagedFunctionPtr<InvokeMethodHandleBatchFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("InvokeMethodHandleBatch"));
+		s_ManagedFunctions.ResolveFieldAccessorFptr = LoadCoralManagedFunctionPtr<ResolveFieldAccessorFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("ResolveFieldAccessor"));
+		s_ManagedFunctions.SetFieldAccessorValueFptr = LoadCoralManagedFunctionPtr<SetFieldAccessorValueFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("SetFieldAccessorValue"));
+		s_ManagedFunctions.GetFieldAccessorValueFptr = LoadCoralManagedFunctionPtr<GetFieldAccessorValueFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("GetFieldAccessorValue"));
+		s_ManagedFunctions.ResolvePropertyAccessorFptr = LoadCoralManagedFunctionPtr<ResolvePropertyAccessorFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("ResolvePropertyAccessor"));
+		s_ManagedFunctions.SetPropertyAccessorValueFptr = LoadCoralManagedFunctionPtr<SetPropertyAccessorValueFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("SetPropertyAccessorValue"));
+		s_ManagedFunctions.GetPropertyAccessorValueFptr = LoadCoralManagedFunctionPtr<GetPropertyAccessorValueFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("GetPropertyAccessorValue"));
 		s_ManagedFunctions.SetFieldValueFptr = LoadCoralManagedFunctionPtr<SetFieldValueFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("SetFieldValue"));
 		s_ManagedFunctions.GetFieldValueFptr = LoadCoralManagedFunctionPtr<GetFieldValueFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("GetFieldValue"));
 		s_ManagedFunctions.SetPropertyValueFptr = LoadCoralManagedFunctionPtr<SetFieldValueFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("SetPropertyValue"));
 		s_ManagedFunctions.GetPropertyValueFptr = LoadCoralManagedFunctionPtr<GetFieldValueFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("GetPropertyValue"));
 		s_ManagedFunctions.DestroyObjectFptr = LoadCoralManagedFunctionPtr<DestroyObjectFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("DestroyObject"));
+		s_ManagedFunctions.DestroyObjectsFptr = LoadCoralManagedFunctionPtr<DestroyObjectsFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("DestroyObjects"));
+		s_ManagedFunctions.InvokeMethodByNameIdFptr = LoadCoralManagedFunctionPtr<InvokeMethodByNameIdFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("InvokeMethodByNameId"));
+		s_ManagedFunctions.InvokeStaticMethodByNameIdFptr = LoadCoralManagedFunctionPtr<InvokeStaticMethodByNameIdFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("InvokeStaticMethodByNameId"));
+		s_ManagedFunctions.SetFieldValueByNameIdFptr = LoadCoralManagedFunctionPtr<SetFieldValueByNameIdFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("SetFieldValueByNameId"));
+		s_ManagedFunctions.GetFieldValueByNameIdFptr = LoadCoralManagedFunctionPtr<GetFieldValueByNameIdFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("GetFieldValueByNameId"));
+		s_ManagedFunctions.SetPropertyValueByNameIdFptr = LoadCoralManagedFunctionPtr<SetPropertyValueByNameIdFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("SetPropertyValueByNameId"));
+		s_ManagedFunctions.GetPropertyValueByNameIdFptr = LoadCoralManagedFunctionPtr<GetPropertyValueByNameIdFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("GetPropertyValueByNameId"));
+		s_ManagedFunctions.CreateWeakReferenceFptr = LoadCoralManagedFunctionPtr<CreateWeakReferenceFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("CreateWeakReference"));
+		s_ManagedFunctions.LockWeakReferenceFptr = LoadCoralManagedFunctionPtr<LockWeakReferenceFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("LockWeakReference"));
+		s_ManagedFunctions.IsWeakReferenceAliveFptr = LoadCoralManagedFunctionPtr<IsWeakReferenceAliveFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("IsWeakReferenceAlive"));
 		s_ManagedFunctions.GetObjectTypeIdFptr = LoadCoralManagedFunctionPtr<GetObjectTypeIdFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("GetObjectTypeId"));
 
 		s_ManagedFunctions.CollectGarbageFptr = LoadCoralManagedFunctionPtr<CollectGarbageFn>(CORAL_STR("Coral.Managed.GarbageCollector, Coral.Managed"), CORAL_STR("CollectGarbage"));
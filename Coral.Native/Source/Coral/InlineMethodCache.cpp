@@ -0,0 +1,97 @@
+#include "Coral/InlineMethodCache.hpp"
+#include "Coral/TypeNameKey.hpp"
+
+#include "ThreadMethodCache.hpp"
+
+#include <atomic>
+
+namespace Coral {
+
+	// Starts at 1 so default constructed entries never match
+	static std::atomic<uint32_t> s_Epoch = 1;
+
+	MethodHandle InlineMethodCache::Find(const Type* InType, uint64_t InKey) const
+	{
+		uint32_t epoch = s_Epoch.load(std::memory_order_acquire);
+
+		for (const auto& entry : m_Entries)
+		{
+			if (entry.Epoch == epoch && entry.ReceiverType == InType && entry.Key == InKey)
+				return entry.Method;
+		}
+
+		return {};
+	}
+
+	void InlineMethodCache::Insert(const Type* InType, uint64_t InKey, MethodHandle InMethod)
+	{
+		// Round-robin replacement, polymorphic call sites with more than EntryCount receivers keep missing and take the slow path
+		auto& entry = m_Entries[m_NextEntry];
+		m_NextEntry = (m_NextEntry + 1) % EntryCount;
+
+		entry.ReceiverType = InType;
+		entry.Key = InKey;
+		entry.Method = InMethod;
+		entry.Epoch = s_Epoch.load(std::memory_order_acquire);
+	}
+
+	uint64_t InlineMethodCache::GetKey(std::string_view InMethodName, const ManagedType* InParameterTypes, size_t InLength)
+	{
+		// Continues the name's FNV-1a hash over the parameter types
+		uint64_t key = TypeNameKey::Hash(InMethodName);
+
+		for (size_t i = 0; i < InLength; i++)
+		{
+			// Offset past every byte value so a parameter type never hashes like another character of the name
+			key ^= static_cast<uint64_t>(InParameterTypes[i]) + 0x100;
+			key *= 0x100000001B3ull;
+		}
+
+		return key;
+	}
+
+	void InlineMethodCache::InvalidateAll()
+	{
+		s_Epoch.fetch_add(1, std::memory_order_acq_rel);
+	}
+
+	struct ThreadMethodCacheEntry
+	{
+		const Type* ReceiverType = nullptr;
+		uint64_t Key = 0;
+		MethodHandle Method;
+		uint32_t Epoch = 0;
+	};
+
+	static constexpr size_t ThreadMethodCacheEntryCount = 256;
+	static thread_local std::array<ThreadMethodCacheEntry, ThreadMethodCacheEntryCount> s_ThreadMethodCache;
+
+	static ThreadMethodCacheEntry& GetThreadMethodCacheEntry(const Type* InType, uint64_t InKey)
+	{
+		// Fibonacci hashing, the top bits of the product depend on every bit of the receiver and key
+		uint64_t hash = (InKey ^ reinterpret_cast<uintptr_t>(InType)) * 0x9E3779B97F4A7C15ull;
+		return s_ThreadMethodCache[hash >> 56];
+	}
+
+	static_assert(ThreadMethodCacheEntryCount == 256, "GetThreadMethodCacheEntry takes the top 8 bits of the hash");
+
+	MethodHandle ThreadMethodCache::Find(const Type* InType, uint64_t InKey)
+	{
+		const auto& entry = GetThreadMethodCacheEntry(InType, InKey);
+
+		if (entry.Epoch == s_Epoch.load(std::memory_order_acquire) && entry.ReceiverType == InType && entry.Key == InKey)
+			return entry.Method;
+
+		return {};
+	}
+
+	void ThreadMethodCache::Insert(const Type* InType, uint64_t InKey, MethodHandle InMethod)
+	{
+		auto& entry = GetThreadMethodCacheEntry(InType, InKey);
+		entry.ReceiverType = InType;
+		entry.Key = InKey;
+		entry.Method = InMethod;
+		entry.Epoch = s_Epoch.load(std::memory_order_acquire);
+	}
+
+}
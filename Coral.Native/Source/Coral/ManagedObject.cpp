@@ -6,6 +6,7 @@
 #include "Coral/TypeCache.hpp"
 
 #include "CoralManagedFunctions.hpp"
+#include "ThreadMethodCache.hpp"
 
 namespace Coral {
 
@@ -13,12 +14,29 @@ namespace Coral {
 	{
 		if (InOther.m_Handle)
 		{
-			m_Handle = s_ManagedFunctions.CopyObjectFptr(InOther.m_Handle);
+			auto* refCount = InOther.m_RefCount.load(std::memory_order_acquire);
+
+			if (!refCount)
+			{
+				// Several threads may copy the same object at once, only one of them gets to publish the count
+				auto* newRefCount = new std::atomic<uint32_t>(1);
+
+				if (InOther.m_RefCount.compare_exchange_strong(refCount, newRefCount, std::memory_order_acq_rel, std::memory_order_acquire))
+					refCount = newRefCount;
+				else
+					delete newRefCount;
+			}
+
+			refCount->fetch_add(1, std::memory_order_relaxed);
+
+			m_Handle = InOther.m_Handle;
 			m_Type = InOther.m_Type;
+			m_RefCount.store(refCount, std::memory_order_relaxed);
 		}
 	}
 
-	ManagedObject::ManagedObject(ManagedObject&& InOther) noexcept : m_Handle(InOther.m_Handle), m_Type(InOther.m_Type)
+	ManagedObject::ManagedObject(ManagedObject&& InOther) noexcept
+		: m_Handle(InOther.m_Handle), m_Type(InOther.m_Type), m_RefCount(InOther.m_RefCount.exchange(nullptr, std::memory_order_relaxed))
 	{
 		InOther.m_Handle = nullptr;
 		InOther.m_Type = nullptr;
@@ -33,8 +51,10 @@ namespace Coral {
 	{
 		if (this != &InOther)
 		{
+			Destroy();
 			m_Handle = InOther.m_Handle;
 			m_Type = InOther.m_Type;
+			m_RefCount.store(InOther.m_RefCount.exchange(nullptr, std::memory_order_relaxed), std::memory_order_relaxed);
 			InOther.m_Handle = nullptr;
 			InOther.m_Type = nullptr;
 		}
@@ -46,17 +66,27 @@ namespace Coral {
 	{
 		if (this != &InOther)
 		{
-			Destroy();
-			if (InOther.m_Handle)
-			{
-				m_Handle = s_ManagedFunctions.CopyObjectFptr(InOther.m_Handle);
-				m_Type = InOther.m_Type;
-			}
+			ManagedObject copy(InOther);
+			*this = std::move(copy);
 		}
 
 		return *this;
 	}
 
+	bool ManagedObject::Release()
+	{
+		auto* refCount = m_RefCount.load(std::memory_order_acquire);
+
+		if (!refCount)
+			return true;
+
+		if (refCount->fetch_sub(1, std::memory_order_acq_rel) != 1)
+			return false;
+
+		delete refCount;
+		return true;
+	}
+
 	void ManagedObject::InvokeMethodInternal(std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const
 	{
 		// NOTE(Peter): If you get an exception in this function it's most likely because you're using a Native only debugger type in Visual Studio
@@ -75,6 +105,49 @@ namespace Coral {
 		String::Free(methodName);
 	}
 
+	void ManagedObject::InvokeMethodHandleInternal(const MethodHandle& InMethod, const void** InParameters, size_t InLength, void* InResultStorage) const
+	{
+		s_ManagedFunctions.InvokeMethodHandleFptr(m_Handle, InMethod.m_Handle, InParameters, static_cast<int32_t>(InLength), InResultStorage);
+	}
+
+	void ManagedObject::InvokeMethodCachedInternal(InlineMethodCache* InCache, std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const
+	{
+		// Objects that haven't been given a type yet (e.g returned from managed code) can't be cached
+		if (!m_Type)
+		{
+			if (InResultStorage)
+				InvokeMethodRetInternal(InMethodName, InParameters, InParameterTypes, InLength, InResultStorage);
+			else
+				InvokeMethodInternal(InMethodName, InParameters, InParameterTypes, InLength);
+
+			return;
+		}
+
+		uint64_t key = InlineMethodCache::GetKey(InMethodName, InParameterTypes, InLength);
+		auto method = InCache ? InCache->Find(m_Type, key) : ThreadMethodCache::Find(m_Type, key);
+
+		if (!method)
+		{
+			// Failures are reported by the lookup itself
+			method = m_Type->GetMethodInternal(InMethodName, InParameterTypes, InLength);
+
+			if (!method)
+				return;
+
+			if (InCache)
+				InCache->Insert(m_Type, key, method);
+			else
+				ThreadMethodCache::Insert(m_Type, key, method);
+		}
+
+		InvokeMethodHandleInternal(method, InParameters, InLength, InResultStorage);
+	}
+
+	void ManagedObject::InvokeMethodInternal(NameId InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const
+	{
+		s_ManagedFunctions.InvokeMethodByNameIdFptr(m_Handle, InMethodName.m_Id, InParameters, InParameterTypes, static_cast<int32_t>(InLength), InResultStorage);
+	}
+
 	void ManagedObject::SetFieldValueRaw(std::string_view InFieldName, void* InValue) const
 	{
 		auto fieldName = String::New(InFieldName);
@@ -89,6 +162,16 @@ namespace Coral {
 		String::Free(fieldName);
 	}
 
+	void ManagedObject::SetFieldValueRaw(const FieldAccessor& InField, void* InValue) const
+	{
+		s_ManagedFunctions.SetFieldAccessorValueFptr(m_Handle, InField.m_Handle, InValue);
+	}
+
+	void ManagedObject::GetFieldValueRaw(const FieldAccessor& InField, void* OutValue) const
+	{
+		s_ManagedFunctions.GetFieldAccessorValueFptr(m_Handle, InField.m_Handle, OutValue);
+	}
+
 	void ManagedObject::SetPropertyValueRaw(std::string_view InPropertyName, void* InValue) const
 	{
 		auto propertyName = String::New(InPropertyName);
@@ -103,6 +186,36 @@ namespace Coral {
 		String::Free(propertyName);
 	}
 
+	void ManagedObject::SetPropertyValueRaw(const PropertyAccessor& InProperty, void* InValue) const
+	{
+		s_ManagedFunctions.SetPropertyAccessorValueFptr(m_Handle, InProperty.m_Handle, InValue);
+	}
+
+	void ManagedObject::GetPropertyValueRaw(const PropertyAccessor& InProperty, void* OutValue) const
+	{
+		s_ManagedFunctions.GetPropertyAccessorValueFptr(m_Handle, InProperty.m_Handle, OutValue);
+	}
+
+	void ManagedObject::SetFieldValueRaw(NameId InFieldName, void* InValue) const
+	{
+		s_ManagedFunctions.SetFieldValueByNameIdFptr(m_Handle, InFieldName.m_Id, InValue);
+	}
+
+	void ManagedObject::GetFieldValueRaw(NameId InFieldName, void* OutValue) const
+	{
+		s_ManagedFunctions.GetFieldValueByNameIdFptr(m_Handle, InFieldName.m_Id, OutValue);
+	}
+
+	void ManagedObject::SetPropertyValueRaw(NameId InPropertyName, void* InValue) const
+	{
+		s_ManagedFunctions.SetPropertyValueByNameIdFptr(m_Handle, InPropertyName.m_Id, InValue);
+	}
+
+	void ManagedObject::GetPropertyValueRaw(NameId InPropertyName, void* OutValue) const
+	{
+		s_ManagedFunctions.GetPropertyValueByNameIdFptr(m_Handle, InPropertyName.m_Id, OutValue);
+	}
+
 	const Type& ManagedObject::GetType()
 	{
 		if (!m_Type)
@@ -120,9 +233,35 @@ namespace Coral {
 		if (!m_Handle)
 			return;
 
-		s_ManagedFunctions.DestroyObjectFptr(m_Handle);
+		if (Release())
+			s_ManagedFunctions.DestroyObjectFptr(m_Handle);
+
 		m_Handle = nullptr;
 		m_Type = nullptr;
+		m_RefCount.store(nullptr, std::memory_order_relaxed);
+	}
+
+	void ManagedObject::DestroyBatch(ManagedObject* InObjects, size_t InCount)
+	{
+		if (InCount == 0)
+			return;
+
+		// Objects that still have other copies alive only drop their reference, null handles are skipped by the managed side
+		for (size_t i = 0; i < InCount; i++)
+		{
+			if (InObjects[i].m_Handle && !InObjects[i].Release())
+				InObjects[i].m_Handle = nullptr;
+
+			InObjects[i].m_RefCount.store(nullptr, std::memory_order_relaxed);
+		}
+
+		s_ManagedFunctions.DestroyObjectsFptr(InObjects, static_cast<int32_t>(sizeof(ManagedObject)), static_cast<int32_t>(InCount));
+
+		for (size_t i = 0; i < InCount; i++)
+		{
+			InObjects[i].m_Handle = nullptr;
+			InObjects[i].m_Type = nullptr;
+		}
 	}
 
 }
@@ -4,20 +4,52 @@
 #include "Coral/TypeCache.hpp"
 
 #include "CoralManagedFunctions.hpp"
+#include "TypeTableCache.hpp"
+
+#include <algorithm>
 
 namespace Coral {
 
+	static const MemberTableMethod& GetCachedMethod(const CachedMetadata& InMetadata, int32_t InTypeIndex, int32_t InIndex)
+	{
+		return InMetadata.Methods[InMetadata.TypeMembers[InTypeIndex].FirstMethod + InIndex];
+	}
+
+	ManagedHandle MethodInfo::GetHandle() const
+	{
+		if (m_Handle == -1 && m_CachedMetadata != nullptr)
+		{
+			const auto& method = GetCachedMethod(*m_CachedMetadata, m_CachedTypeIndex, m_CachedIndex);
+			TypeId typeId = m_CachedMetadata->GetLocalType(m_CachedTypeIndex + 1)->GetTypeId();
+
+			auto name = String::New(m_CachedMetadata->GetMemberName(method.NameOffset, method.NameLength));
+			m_Handle = s_ManagedFunctions.ResolveTypeMethodFptr(typeId, m_CachedIndex, method.Token, name);
+			String::Free(name);
+		}
+
+		return m_Handle;
+	}
+
 	String MethodInfo::GetName() const
 	{
+		if (m_CachedMetadata != nullptr)
+		{
+			const auto& method = GetCachedMethod(*m_CachedMetadata, m_CachedTypeIndex, m_CachedIndex);
+			return String::New(m_CachedMetadata->GetMemberName(method.NameOffset, method.NameLength));
+		}
+
 		return s_ManagedFunctions.GetMethodInfoNameFptr(m_Handle);
 	}
 
 	Type& MethodInfo::GetReturnType()
 	{
+		if (!m_ReturnType && m_CachedMetadata != nullptr)
+			m_ReturnType = m_CachedMetadata->GetLocalType(GetCachedMethod(*m_CachedMetadata, m_CachedTypeIndex, m_CachedIndex).ReturnType);
+
 		if (!m_ReturnType)
 		{
 			Type returnType;
-			s_ManagedFunctions.GetMethodInfoReturnTypeFptr(m_Handle, &returnType.m_Id);
+			s_ManagedFunctions.GetMethodInfoReturnTypeFptr(GetHandle(), &returnType.m_Id);
 			m_ReturnType = TypeCache::Get().CacheType(std::move(returnType));
 		}
 
@@ -26,13 +58,30 @@ namespace Coral {
 
 	const std::vector<Type*>& MethodInfo::GetParameterTypes()
 	{
+		if (m_ParameterTypes.empty() && m_CachedMetadata != nullptr)
+		{
+			const auto& method = GetCachedMethod(*m_CachedMetadata, m_CachedTypeIndex, m_CachedIndex);
+			const TypeId* parameterTypes = m_CachedMetadata->ParameterTypes + method.FirstParameter;
+
+			// Parameters of types from other assemblies are stored as 0, those still have to come from the runtime
+			if (std::all_of(parameterTypes, parameterTypes + method.ParameterCount, [](TypeId InType) { return InType != 0; }))
+			{
+				m_ParameterTypes.resize(static_cast<size_t>(method.ParameterCount));
+
+				for (size_t i = 0; i < m_ParameterTypes.size(); i++)
+					m_ParameterTypes[i] = m_CachedMetadata->GetLocalType(parameterTypes[i]);
+
+				return m_ParameterTypes;
+			}
+		}
+
 		if (m_ParameterTypes.empty())
 		{
 			int32_t parameterCount;
-			s_ManagedFunctions.GetMethodInfoParameterTypesFptr(m_Handle, nullptr, &parameterCount);
+			s_ManagedFunctions.GetMethodInfoParameterTypesFptr(GetHandle(), nullptr, &parameterCount);
 
 			std::vector<TypeId> parameterTypes(static_cast<size_t>(parameterCount));
-			s_ManagedFunctions.GetMethodInfoParameterTypesFptr(m_Handle, parameterTypes.data(), &parameterCount);
+			s_ManagedFunctions.GetMethodInfoParameterTypesFptr(GetHandle(), parameterTypes.data(), &parameterCount);
 
 			m_ParameterTypes.resize(parameterTypes.size());
 
@@ -49,16 +98,19 @@ namespace Coral {
 
 	TypeAccessibility MethodInfo::GetAccessibility() const
 	{
+		if (m_CachedMetadata != nullptr)
+			return GetCachedMethod(*m_CachedMetadata, m_CachedTypeIndex, m_CachedIndex).Accessibility;
+
 		return s_ManagedFunctions.GetMethodInfoAccessibilityFptr(m_Handle);
 	}
 
 	std::vector<Attribute> MethodInfo::GetAttributes() const
 	{
 		int32_t attributeCount;
-		s_ManagedFunctions.GetMethodInfoAttributesFptr(m_Handle, nullptr, &attributeCount);
+		s_ManagedFunctions.GetMethodInfoAttributesFptr(GetHandle(), nullptr, &attributeCount);
 
 		std::vector<ManagedHandle> attributeHandles(static_cast<size_t>(attributeCount));
-		s_ManagedFunctions.GetMethodInfoAttributesFptr(m_Handle, attributeHandles.data(), &attributeCount);
+		s_ManagedFunctions.GetMethodInfoAttributesFptr(GetHandle(), attributeHandles.data(), &attributeCount);
 
 		std::vector<Attribute> result(attributeHandles.size());
 		for (size_t i = 0; i < attributeHandles.size(); i++)
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Coral/InlineMethodCache.hpp"
+
+namespace Coral {
+
+	// Backs the name-based InvokeMethod / InvokeStaticMethod calls that don't pass their own InlineMethodCache.
+	// One direct-mapped table per thread, indexed by the receiver type and method key, so calls only replace each other's entries when they map to the same one.
+	// Shares the InlineMethodCache epoch, so unloading an AssemblyLoadContext invalidates it as well.
+	struct ThreadMethodCache
+	{
+		static MethodHandle Find(const Type* InType, uint64_t InKey);
+		static void Insert(const Type* InType, uint64_t InKey, MethodHandle InMethod);
+	};
+
+}
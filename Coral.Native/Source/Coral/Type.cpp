@@ -3,9 +3,65 @@
 #include "Coral/Attribute.hpp"
 
 #include "CoralManagedFunctions.hpp"
+#include "ThreadMethodCache.hpp"
+#include "TypeTableCache.hpp"
+#include "Verify.hpp"
 
 namespace Coral {
 
+	Type::Type(const Type& InOther)
+	{
+		*this = InOther;
+	}
+
+	Type::Type(Type&& InOther) noexcept
+	{
+		*this = std::move(InOther);
+	}
+
+	Type::~Type()
+	{
+		delete m_InterfaceTypes.load(std::memory_order_acquire);
+	}
+
+	Type& Type::operator=(const Type& InOther)
+	{
+		if (this == &InOther)
+			return *this;
+
+		auto* interfaceTypes = InOther.m_InterfaceTypes.load(std::memory_order_acquire);
+
+		m_Id = InOther.m_Id;
+		m_BaseType.store(InOther.m_BaseType.load(std::memory_order_acquire), std::memory_order_release);
+		delete m_InterfaceTypes.exchange(interfaceTypes ? new std::vector<Type*>(*interfaceTypes) : nullptr, std::memory_order_acq_rel);
+		m_ElementType.store(InOther.m_ElementType.load(std::memory_order_acquire), std::memory_order_release);
+		m_HasMetadata = InOther.m_HasMetadata;
+		m_IsSZArray = InOther.m_IsSZArray;
+		m_Size = InOther.m_Size;
+		m_ManagedType = InOther.m_ManagedType;
+		m_CachedMetadata = InOther.m_CachedMetadata;
+		m_CachedMetadataIndex = InOther.m_CachedMetadataIndex;
+		return *this;
+	}
+
+	Type& Type::operator=(Type&& InOther) noexcept
+	{
+		if (this == &InOther)
+			return *this;
+
+		m_Id = InOther.m_Id;
+		m_BaseType.store(InOther.m_BaseType.load(std::memory_order_acquire), std::memory_order_release);
+		delete m_InterfaceTypes.exchange(InOther.m_InterfaceTypes.exchange(nullptr, std::memory_order_acq_rel), std::memory_order_acq_rel);
+		m_ElementType.store(InOther.m_ElementType.load(std::memory_order_acquire), std::memory_order_release);
+		m_HasMetadata = InOther.m_HasMetadata;
+		m_IsSZArray = InOther.m_IsSZArray;
+		m_Size = InOther.m_Size;
+		m_ManagedType = InOther.m_ManagedType;
+		m_CachedMetadata = InOther.m_CachedMetadata;
+		m_CachedMetadataIndex = InOther.m_CachedMetadataIndex;
+		return *this;
+	}
+
 	String Type::GetFullName() const
 	{
 		return s_ManagedFunctions.GetFullTypeNameFptr(m_Id);
@@ -18,43 +74,57 @@ namespace Coral {
 
 	Type& Type::GetBaseType()
 	{
-		if (!m_BaseType)
+		Type* baseType = m_BaseType.load(std::memory_order_acquire);
+
+		if (!baseType)
 		{
-			Type baseType;
-			s_ManagedFunctions.GetBaseTypeFptr(m_Id, &baseType.m_Id);
-			m_BaseType = TypeCache::Get().CacheType(std::move(baseType));
+			// Threads racing here all get the same type back from the cache, so whichever store lands last is fine
+			Type type;
+			s_ManagedFunctions.GetBaseTypeFptr(m_Id, &type.m_Id);
+			baseType = TypeCache::Get().CacheType(std::move(type));
+			m_BaseType.store(baseType, std::memory_order_release);
 		}
 
-		return *m_BaseType;
+		return *baseType;
 	}
 
 	std::vector<Type*>& Type::GetInterfaceTypes()
 	{
-		if (!m_InterfaceTypes)
-		{
-			int count;
-			s_ManagedFunctions.GetInterfaceTypeCountFptr(m_Id, &count);
+		auto* interfaceTypes = m_InterfaceTypes.load(std::memory_order_acquire);
 
-			std::vector<TypeId> typeIds;
-			typeIds.resize(static_cast<size_t>(count));
-			s_ManagedFunctions.GetInterfaceTypesFptr(m_Id, typeIds.data());
+		if (interfaceTypes)
+			return *interfaceTypes;
 
-			m_InterfaceTypes = std::vector<Type*>();
-			m_InterfaceTypes->reserve(static_cast<size_t>(count));
+		int count;
+		s_ManagedFunctions.GetInterfaceTypeCountFptr(m_Id, &count);
 
-			for (auto id : typeIds)
-			{
-				Type type;
-				type.m_Id = id;
-				m_InterfaceTypes->emplace_back(TypeCache::Get().CacheType(std::move(type)));
-			}
+		std::vector<TypeId> typeIds;
+		typeIds.resize(static_cast<size_t>(count));
+		s_ManagedFunctions.GetInterfaceTypesFptr(m_Id, typeIds.data());
+
+		auto newInterfaceTypes = std::make_unique<std::vector<Type*>>();
+		newInterfaceTypes->reserve(static_cast<size_t>(count));
+
+		for (auto id : typeIds)
+		{
+			Type type;
+			type.m_Id = id;
+			newInterfaceTypes->emplace_back(TypeCache::Get().CacheType(std::move(type)));
 		}
 
-		return *m_InterfaceTypes;
+		// Only the first thread to finish publishes its list, the others return that one and drop their own
+		if (m_InterfaceTypes.compare_exchange_strong(interfaceTypes, newInterfaceTypes.get(), std::memory_order_acq_rel, std::memory_order_acquire))
+			return *newInterfaceTypes.release();
+
+		return *interfaceTypes;
 	}
 
 	int32_t Type::GetSize() const
 	{
+		// The type table reports -1 for types that can't be marshalled, ask again so the failure is reported like before
+		if (m_HasMetadata && m_Size >= 0)
+			return m_Size;
+
 		return s_ManagedFunctions.GetTypeSizeFptr(m_Id);
 	}
 
@@ -75,6 +145,20 @@ namespace Coral {
 
 	std::vector<MethodInfo> Type::GetMethods() const
 	{
+		// Handles are only resolved once a method needs something the cache doesn't have, see MethodInfo::GetHandle
+		if (m_CachedMetadata != nullptr)
+		{
+			std::vector<MethodInfo> methods(static_cast<size_t>(m_CachedMetadata->TypeMembers[m_CachedMetadataIndex].MethodCount));
+			for (size_t i = 0; i < methods.size(); i++)
+			{
+				methods[i].m_CachedMetadata = m_CachedMetadata;
+				methods[i].m_CachedTypeIndex = m_CachedMetadataIndex;
+				methods[i].m_CachedIndex = static_cast<int32_t>(i);
+			}
+
+			return methods;
+		}
+
 		int32_t methodCount = 0;
 		s_ManagedFunctions.GetTypeMethodsFptr(m_Id, nullptr, &methodCount);
 		std::vector<ManagedHandle> handles(static_cast<size_t>(methodCount));
@@ -89,6 +173,19 @@ namespace Coral {
 
 	std::vector<FieldInfo> Type::GetFields() const
 	{
+		if (m_CachedMetadata != nullptr)
+		{
+			std::vector<FieldInfo> fields(static_cast<size_t>(m_CachedMetadata->TypeMembers[m_CachedMetadataIndex].FieldCount));
+			for (size_t i = 0; i < fields.size(); i++)
+			{
+				fields[i].m_CachedMetadata = m_CachedMetadata;
+				fields[i].m_CachedTypeIndex = m_CachedMetadataIndex;
+				fields[i].m_CachedIndex = static_cast<int32_t>(i);
+			}
+
+			return fields;
+		}
+
 		int32_t fieldCount = 0;
 		s_ManagedFunctions.GetTypeFieldsFptr(m_Id, nullptr, &fieldCount);
 		std::vector<ManagedHandle> handles(static_cast<size_t>(fieldCount));
@@ -136,24 +233,33 @@ namespace Coral {
 
 	ManagedType Type::GetManagedType() const
 	{
+		if (m_HasMetadata)
+			return m_ManagedType;
+
 		return s_ManagedFunctions.GetTypeManagedTypeFptr(m_Id);
 	}
 
 	bool Type::IsSZArray() const
 	{
+		if (m_HasMetadata)
+			return m_IsSZArray;
+
 		return s_ManagedFunctions.IsTypeSZArrayFptr(m_Id);
 	}
 
 	Type& Type::GetElementType()
 	{
-		if (!m_ElementType)
+		Type* elementType = m_ElementType.load(std::memory_order_acquire);
+
+		if (!elementType)
 		{
-			Type elementType;
-			s_ManagedFunctions.GetElementTypeFptr(m_Id, &elementType.m_Id);
-			m_ElementType = TypeCache::Get().CacheType(std::move(elementType));
+			Type type;
+			s_ManagedFunctions.GetElementTypeFptr(m_Id, &type.m_Id);
+			elementType = TypeCache::Get().CacheType(std::move(type));
+			m_ElementType.store(elementType, std::memory_order_release);
 		}
 
-		return *m_ElementType;
+		return *elementType;
 	}
 
 	bool Type::operator==(const Type& InOther) const
@@ -161,10 +267,89 @@ namespace Coral {
 		return m_Id == InOther.m_Id;
 	}
 
+	MethodHandle Type::GetMethodInternal(std::string_view InMethodName, const ManagedType* InParameterTypes, size_t InLength) const
+	{
+		auto methodName = String::New(InMethodName);
+		MethodHandle result;
+		result.m_Handle = s_ManagedFunctions.ResolveMethodFptr(m_Id, methodName, InParameterTypes, static_cast<int32_t>(InLength));
+		String::Free(methodName);
+		return result;
+	}
+
+	FieldAccessor Type::GetFieldAccessor(std::string_view InFieldName) const
+	{
+		auto fieldName = String::New(InFieldName);
+		FieldAccessor result;
+		result.m_Handle = s_ManagedFunctions.ResolveFieldAccessorFptr(m_Id, fieldName);
+		String::Free(fieldName);
+		return result;
+	}
+
+	PropertyAccessor Type::GetPropertyAccessor(std::string_view InPropertyName) const
+	{
+		auto propertyName = String::New(InPropertyName);
+		PropertyAccessor result;
+		result.m_Handle = s_ManagedFunctions.ResolvePropertyAccessorFptr(m_Id, propertyName);
+		String::Free(propertyName);
+		return result;
+	}
+
+	void Type::InvokeStaticMethodHandleInternal(const MethodHandle& InMethod, const void** InParameters, size_t InLength, void* InResultStorage) const
+	{
+		s_ManagedFunctions.InvokeStaticMethodHandleFptr(InMethod.m_Handle, InParameters, static_cast<int32_t>(InLength), InResultStorage);
+	}
+
+	void Type::InvokeMethodBatchInternal(const MethodHandle& InMethod, const ManagedObject* InObjects, size_t InCount, const void** InParameters, size_t InLength, void* OutResults, size_t InResultStride) const
+	{
+		// The count is marshalled as an int, reject batches that don't fit instead of silently running only part of them
+		CORAL_VERIFY(InCount <= static_cast<size_t>(INT32_MAX));
+
+		if (InCount == 0 || InCount > static_cast<size_t>(INT32_MAX))
+			return;
+
+		s_ManagedFunctions.InvokeMethodHandleBatchFptr(InObjects, static_cast<int32_t>(sizeof(ManagedObject)), static_cast<int32_t>(InCount), InMethod.m_Handle, InParameters, static_cast<int32_t>(InLength), OutResults, static_cast<int32_t>(InResultStride));
+	}
+
 	ManagedObject Type::CreateInstanceInternal(const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const
 	{
 		ManagedObject result;
-		result.m_Handle = s_ManagedFunctions.CreateObjectFptr(m_Id, false, InParameters, InParameterTypes, static_cast<int32_t>(InLength));
+		result.m_Handle = CreateObjectInternal(false, InParameters, InParameterTypes, InLength);
+		result.m_Type = this;
+		return result;
+	}
+
+	void* Type::CreateObjectInternal(bool InWeakRef, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const
+	{
+		return s_ManagedFunctions.CreateObjectFptr(m_Id, InWeakRef, InParameters, InParameterTypes, static_cast<int32_t>(InLength));
+	}
+
+	void Type::CreateInstancesInternal(ManagedObject* OutObjects, size_t InCount, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const
+	{
+		CORAL_VERIFY(InCount <= static_cast<size_t>(INT32_MAX));
+
+		if (InCount == 0 || InCount > static_cast<size_t>(INT32_MAX))
+			return;
+
+		for (size_t i = 0; i < InCount; i++)
+		{
+			OutObjects[i].Destroy();
+			OutObjects[i].m_Type = this;
+		}
+
+		s_ManagedFunctions.CreateObjectsFptr(m_Id, false, InParameters, InParameterTypes, static_cast<int32_t>(InLength), OutObjects, static_cast<int32_t>(sizeof(ManagedObject)), static_cast<int32_t>(InCount));
+	}
+
+	ConstructorHandle Type::GetConstructorInternal(const ManagedType* InParameterTypes, size_t InLength) const
+	{
+		ConstructorHandle result;
+		result.m_Handle = s_ManagedFunctions.ResolveConstructorFptr(m_Id, InParameterTypes, static_cast<int32_t>(InLength));
+		return result;
+	}
+
+	ManagedObject Type::CreateInstanceInternal(ConstructorHandle InConstructor, const void** InParameters, size_t InLength) const
+	{
+		ManagedObject result;
+		result.m_Handle = s_ManagedFunctions.CreateObjectFromConstructorFptr(InConstructor.m_Handle, false, InParameters, static_cast<int32_t>(InLength));
 		result.m_Type = this;
 		return result;
 	}
@@ -183,6 +368,33 @@ namespace Coral {
 		String::Free(methodName);
 	}
 
+	void Type::InvokeStaticMethodCachedInternal(InlineMethodCache* InCache, std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const
+	{
+		uint64_t key = InlineMethodCache::GetKey(InMethodName, InParameterTypes, InLength);
+		auto method = InCache ? InCache->Find(this, key) : ThreadMethodCache::Find(this, key);
+
+		if (!method)
+		{
+			// Failures are reported by the lookup itself
+			method = GetMethodInternal(InMethodName, InParameterTypes, InLength);
+
+			if (!method)
+				return;
+
+			if (InCache)
+				InCache->Insert(this, key, method);
+			else
+				ThreadMethodCache::Insert(this, key, method);
+		}
+
+		InvokeStaticMethodHandleInternal(method, InParameters, InLength, InResultStorage);
+	}
+
+	void Type::InvokeStaticMethodInternal(NameId InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const
+	{
+		s_ManagedFunctions.InvokeStaticMethodByNameIdFptr(m_Id, InMethodName.m_Id, InParameters, InParameterTypes, static_cast<int32_t>(InLength), InResultStorage);
+	}
+
 
 	ReflectionType::operator Type&() const
 	{
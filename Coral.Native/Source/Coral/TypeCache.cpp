@@ -11,29 +11,54 @@ namespace Coral {
 
 	Type* TypeCache::CacheType(Type&& InType)
 	{
+		std::unique_lock lock(m_Mutex);
+
+		if (auto it = m_IDCache.find(InType.GetTypeId()); it != m_IDCache.end())
+			return it->second;
+
+		Type* type = &m_Types.Insert(std::move(InType)).second;
+		String name = type->GetFullName();
+
+		// Function pointer types don't have a full name, they can only be looked up by ID
+		if (name.Data() != nullptr)
+			m_NameCache.InsertOrAssign(std::string(name), type);
+
+		String::Free(name);
+		m_IDCache[type->GetTypeId()] = type;
+		return type;
+	}
+
+	Type* TypeCache::CacheType(Type&& InType, std::string_view InFullName)
+	{
+		std::unique_lock lock(m_Mutex);
+
+		if (auto it = m_IDCache.find(InType.GetTypeId()); it != m_IDCache.end())
+			return it->second;
+
 		Type* type = &m_Types.Insert(std::move(InType)).second;
-		m_NameCache[type->GetFullName()] = type;
+		m_NameCache.InsertOrAssign(InFullName, type);
 		m_IDCache[type->GetTypeId()] = type;
 		return type;
 	}
 
-	Type* TypeCache::GetTypeByName(std::string_view InName) const
+	Type* TypeCache::GetTypeByName(const TypeNameKey& InName) const
 	{
-		auto name = std::string(InName);
-		auto it = m_NameCache.find(name);
-		return it != m_NameCache.end() ? it->second : nullptr;
+		std::shared_lock lock(m_Mutex);
+		return m_NameCache.Find(InName);
 	}
 
 	Type* TypeCache::GetTypeByID(TypeId InTypeID) const
 	{
+		std::shared_lock lock(m_Mutex);
 		auto it = m_IDCache.find(InTypeID);
 		return it != m_IDCache.end() ? it->second : nullptr;
 	}
 
 	void TypeCache::Clear()
 	{
+		std::unique_lock lock(m_Mutex);
 		m_Types.Clear();
-		m_NameCache.clear();
+		m_NameCache.Clear();
 		m_IDCache.clear();
 	}
 
@@ -0,0 +1,89 @@
+#include "Coral/TypeNameMap.hpp"
+
+#include <algorithm>
+
+namespace Coral {
+
+	static constexpr size_t s_MinCapacity = 16;
+
+	Type* TypeNameMap::Find(const TypeNameKey& InKey) const
+	{
+		if (m_Slots.empty())
+			return nullptr;
+
+		return m_Slots[FindSlot(InKey)].Value;
+	}
+
+	void TypeNameMap::InsertOrAssign(const TypeNameKey& InKey, Type* InType)
+	{
+		if ((m_Size + 1) * 2 > m_Slots.size())
+			Rehash(std::max(m_Slots.size() * 2, s_MinCapacity));
+
+		auto& slot = m_Slots[FindSlot(InKey)];
+
+		if (slot.Value == nullptr)
+		{
+			slot.Hash = InKey.GetHash();
+			slot.Name = InKey.GetName();
+			m_Size++;
+		}
+
+		slot.Value = InType;
+	}
+
+	void TypeNameMap::Reserve(size_t InCount)
+	{
+		size_t capacity = s_MinCapacity;
+		while (capacity < InCount * 2)
+			capacity *= 2;
+
+		if (capacity > m_Slots.size())
+			Rehash(capacity);
+	}
+
+	void TypeNameMap::Clear()
+	{
+		m_Slots.clear();
+		m_Size = 0;
+	}
+
+	size_t TypeNameMap::FindSlot(const TypeNameKey& InKey) const
+	{
+		// The capacity is always a power of two and the map never more than half full, so this always finds an empty slot
+		size_t mask = m_Slots.size() - 1;
+		size_t index = static_cast<size_t>(InKey.GetHash()) & mask;
+
+		while (m_Slots[index].Value != nullptr)
+		{
+			const auto& slot = m_Slots[index];
+
+			if (slot.Hash == InKey.GetHash() && slot.Name == InKey.GetName())
+				break;
+
+			index = (index + 1) & mask;
+		}
+
+		return index;
+	}
+
+	void TypeNameMap::Rehash(size_t InCapacity)
+	{
+		std::vector<Slot> oldSlots(InCapacity);
+		oldSlots.swap(m_Slots);
+
+		size_t mask = InCapacity - 1;
+
+		for (auto& oldSlot : oldSlots)
+		{
+			if (oldSlot.Value == nullptr)
+				continue;
+
+			size_t index = static_cast<size_t>(oldSlot.Hash) & mask;
+			while (m_Slots[index].Value != nullptr)
+				index = (index + 1) & mask;
+
+			m_Slots[index] = std::move(oldSlot);
+		}
+	}
+
+}
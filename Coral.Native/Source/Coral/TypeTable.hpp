@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Coral/Core.hpp"
+#include "Coral/Utility.hpp"
+
+namespace Coral {
+
+	// Mirrors Coral.Managed/Source/TypeTable.cs, the buffer returned by GetAssemblyTypeTable is laid out as:
+	//   TypeTableHeader
+	//   TypeTableEntry[EntryCount]   the assembly's own types first (TypeCount of them), then external base types / interfaces
+	//   TypeId[InterfaceCount]
+	//   char[StringPoolSize]         UTF-8 full names, not null terminated
+	enum class TypeTableFlags : uint32_t
+	{
+		None = 0,
+		IsSZArray = 1 << 0,
+		External = 1 << 1,
+	};
+
+	struct TypeTableHeader
+	{
+		int32_t TypeCount;
+		int32_t EntryCount;
+		int32_t InterfaceCount;
+		int32_t StringPoolSize;
+	};
+
+	struct TypeTableEntry
+	{
+		TypeId Id;
+		TypeId BaseTypeId;
+		int32_t Size;
+		ManagedType Type;
+		TypeTableFlags Flags;
+		int32_t NameOffset;
+		int32_t NameLength;
+		int32_t FirstInterface;
+		int32_t InterfaceCount;
+		int32_t Token;
+
+		bool HasFlag(TypeTableFlags InFlag) const { return (static_cast<uint32_t>(Flags) & static_cast<uint32_t>(InFlag)) != 0; }
+	};
+
+	// Mirrors Coral.Managed/Source/MemberTable.cs, the buffer returned by GetAssemblyMemberTable is laid out as:
+	//   MemberTableHeader
+	//   MemberTableType[TypeCount]       one per local type of the matching TypeTable, in the same order
+	//   MemberTableMethod[MethodCount]
+	//   MemberTableField[FieldCount]
+	//   TypeId[ParameterCount]
+	//   char[StringPoolSize]             UTF-8 member names, not null terminated
+	// Types are referred to by local reference (their index in the TypeTable's local entries + 1), 0 means the runtime has to be asked.
+	struct MemberTableHeader
+	{
+		int32_t TypeCount;
+		int32_t MethodCount;
+		int32_t FieldCount;
+		int32_t ParameterCount;
+		int32_t StringPoolSize;
+	};
+
+	struct MemberTableType
+	{
+		int32_t FirstMethod;
+		int32_t MethodCount;
+		int32_t FirstField;
+		int32_t FieldCount;
+	};
+
+	struct MemberTableMethod
+	{
+		int32_t Token;
+		int32_t NameOffset;
+		int32_t NameLength;
+		TypeAccessibility Accessibility;
+		TypeId ReturnType;
+		int32_t FirstParameter;
+		int32_t ParameterCount;
+	};
+
+	struct MemberTableField
+	{
+		int32_t Token;
+		int32_t NameOffset;
+		int32_t NameLength;
+		TypeAccessibility Accessibility;
+		TypeId FieldType;
+	};
+
+	static_assert(sizeof(TypeTableHeader) == 16);
+	static_assert(sizeof(TypeTableEntry) == 40);
+	static_assert(sizeof(MemberTableHeader) == 20);
+	static_assert(sizeof(MemberTableType) == 16);
+	static_assert(sizeof(MemberTableMethod) == 28);
+	static_assert(sizeof(MemberTableField) == 20);
+
+}
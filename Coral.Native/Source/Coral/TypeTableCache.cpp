@@ -0,0 +1,329 @@
+#include "TypeTableCache.hpp"
+
+#include <fstream>
+#include <random>
+
+#ifndef CORAL_WINDOWS
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace Coral {
+
+	MappedFile::MappedFile(const std::filesystem::path& InFilePath)
+	{
+#ifdef CORAL_WINDOWS
+		HANDLE file = CreateFileW(InFilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return;
+
+		m_File = file;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+			return;
+
+		m_Mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (m_Mapping == nullptr)
+			return;
+
+		m_Data = static_cast<const std::byte*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0));
+		m_Size = m_Data != nullptr ? static_cast<size_t>(size.QuadPart) : 0;
+#else
+		int fd = open(InFilePath.c_str(), O_RDONLY);
+		if (fd == -1)
+			return;
+
+		struct stat fileStat;
+		if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+		{
+			void* data = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+			if (data != MAP_FAILED)
+			{
+				m_Data = static_cast<const std::byte*>(data);
+				m_Size = static_cast<size_t>(fileStat.st_size);
+			}
+		}
+
+		// The mapping keeps its own reference to the file
+		close(fd);
+#endif
+	}
+
+	MappedFile::~MappedFile()
+	{
+#ifdef CORAL_WINDOWS
+		if (m_Data != nullptr)
+			UnmapViewOfFile(m_Data);
+
+		if (m_Mapping != nullptr)
+			CloseHandle(m_Mapping);
+
+		if (m_File != nullptr)
+			CloseHandle(m_File);
+#else
+		if (m_Data != nullptr)
+			munmap(const_cast<std::byte*>(m_Data), m_Size);
+#endif
+	}
+
+	// Precedes the cached tables in the file
+	struct TypeTableCacheHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		TypeTableCacheKey Key;
+	};
+
+	static_assert(sizeof(TypeTableCacheHeader) == 56);
+
+	static constexpr uint32_t s_TypeTableCacheMagic = 0x54544C43; // "CLTT"
+
+	// Bump whenever the layout of TypeTable, MemberTable or TypeTableCacheHeader changes
+	static constexpr uint32_t s_TypeTableCacheVersion = 2;
+
+	// The MemberTable starts at the next 4 byte boundary after the TypeTable's string pool
+	static size_t AlignMemberTableOffset(size_t InOffset) { return (InOffset + 3) & ~size_t(3); }
+
+	uint64_t TypeTableCacheKey::HashImage(const std::byte* InData, size_t InSize)
+	{
+		constexpr uint64_t Prime = 0x100000001B3;
+		uint64_t hash = 0xCBF29CE484222325 ^ InSize;
+
+		size_t offset = 0;
+		for (; offset + sizeof(uint64_t) <= InSize; offset += sizeof(uint64_t))
+		{
+			uint64_t word;
+			memcpy(&word, InData + offset, sizeof(word));
+			hash = (hash ^ word) * Prime;
+			hash ^= hash >> 32;
+		}
+
+		for (; offset < InSize; offset++)
+			hash = (hash ^ static_cast<uint64_t>(InData[offset])) * Prime;
+
+		return hash;
+	}
+
+	std::filesystem::path TypeTableCache::GetFilePath(const std::filesystem::path& InDirectory, std::string_view InAssemblyName, const TypeTableCacheKey& InKey)
+	{
+		constexpr char Digits[] = "0123456789abcdef";
+
+		std::string fileName(InAssemblyName);
+		fileName += '-';
+
+		for (uint8_t byte : InKey.ModuleVersionId)
+		{
+			fileName += Digits[byte >> 4];
+			fileName += Digits[byte & 0xF];
+		}
+
+		fileName += '-';
+
+		for (int shift = 60; shift >= 0; shift -= 4)
+			fileName += Digits[(InKey.ImageHash >> shift) & 0xF];
+
+		fileName += ".coraltypes";
+		return InDirectory / fileName;
+	}
+
+	bool TypeTableCache::Find(CachedMetadata& InMetadata, const TypeTableCacheKey& InKey)
+	{
+		const auto& file = InMetadata.File;
+
+		if (!file.IsValid() || file.GetSize() < sizeof(TypeTableCacheHeader) + sizeof(TypeTableHeader))
+			return false;
+
+		const auto* header = reinterpret_cast<const TypeTableCacheHeader*>(file.GetData());
+
+		if (header->Magic != s_TypeTableCacheMagic || header->Version != s_TypeTableCacheVersion || memcmp(&header->Key, &InKey, sizeof(TypeTableCacheKey)) != 0)
+			return false;
+
+		const auto* table = reinterpret_cast<const TypeTableHeader*>(header + 1);
+
+		if (table->TypeCount < 0 || table->EntryCount != table->TypeCount || table->InterfaceCount < 0 || table->StringPoolSize < 0)
+			return false;
+
+		size_t memberTableOffset = sizeof(TypeTableCacheHeader) + sizeof(TypeTableHeader);
+		memberTableOffset += static_cast<size_t>(table->TypeCount) * sizeof(TypeTableEntry);
+		memberTableOffset += static_cast<size_t>(table->InterfaceCount) * sizeof(TypeId);
+		memberTableOffset += static_cast<size_t>(table->StringPoolSize);
+		memberTableOffset = AlignMemberTableOffset(memberTableOffset);
+
+		if (file.GetSize() < memberTableOffset + sizeof(MemberTableHeader))
+			return false;
+
+		const auto* members = reinterpret_cast<const MemberTableHeader*>(file.GetData() + memberTableOffset);
+
+		if (members->TypeCount != table->TypeCount || members->MethodCount < 0 || members->FieldCount < 0 || members->ParameterCount < 0 || members->StringPoolSize < 0)
+			return false;
+
+		size_t expectedSize = memberTableOffset + sizeof(MemberTableHeader);
+		expectedSize += static_cast<size_t>(members->TypeCount) * sizeof(MemberTableType);
+		expectedSize += static_cast<size_t>(members->MethodCount) * sizeof(MemberTableMethod);
+		expectedSize += static_cast<size_t>(members->FieldCount) * sizeof(MemberTableField);
+		expectedSize += static_cast<size_t>(members->ParameterCount) * sizeof(TypeId);
+		expectedSize += static_cast<size_t>(members->StringPoolSize);
+
+		if (file.GetSize() != expectedSize)
+			return false;
+
+		// A truncated or hand edited file shouldn't be able to make LoadTypes, or anything enumerating members, read out of bounds
+		const auto* entries = reinterpret_cast<const TypeTableEntry*>(table + 1);
+		const auto* interfaces = reinterpret_cast<const TypeId*>(entries + table->TypeCount);
+
+		auto isLocalReference = [table](TypeId InReference) { return InReference >= 0 && InReference <= table->TypeCount; };
+		auto isRange = [](int32_t InFirst, int32_t InCount, int32_t InSize) { return InFirst >= 0 && InCount >= 0 && int64_t(InFirst) + InCount <= InSize; };
+
+		for (int32_t i = 0; i < table->TypeCount; i++)
+		{
+			const auto& entry = entries[i];
+
+			if (entry.Id != i + 1 || !isLocalReference(entry.BaseTypeId) || entry.Token == 0)
+				return false;
+
+			if (!isRange(entry.NameOffset, entry.NameLength, table->StringPoolSize) || !isRange(entry.FirstInterface, entry.InterfaceCount, table->InterfaceCount))
+				return false;
+		}
+
+		for (int32_t i = 0; i < table->InterfaceCount; i++)
+		{
+			if (!isLocalReference(interfaces[i]))
+				return false;
+		}
+
+		const auto* typeMembers = reinterpret_cast<const MemberTableType*>(members + 1);
+		const auto* methods = reinterpret_cast<const MemberTableMethod*>(typeMembers + members->TypeCount);
+		const auto* fields = reinterpret_cast<const MemberTableField*>(methods + members->MethodCount);
+		const auto* parameterTypes = reinterpret_cast<const TypeId*>(fields + members->FieldCount);
+
+		for (int32_t i = 0; i < members->TypeCount; i++)
+		{
+			if (!isRange(typeMembers[i].FirstMethod, typeMembers[i].MethodCount, members->MethodCount) || !isRange(typeMembers[i].FirstField, typeMembers[i].FieldCount, members->FieldCount))
+				return false;
+		}
+
+		for (int32_t i = 0; i < members->MethodCount; i++)
+		{
+			const auto& method = methods[i];
+
+			if (!isRange(method.NameOffset, method.NameLength, members->StringPoolSize) || !isLocalReference(method.ReturnType) || !isRange(method.FirstParameter, method.ParameterCount, members->ParameterCount))
+				return false;
+		}
+
+		for (int32_t i = 0; i < members->FieldCount; i++)
+		{
+			if (!isRange(fields[i].NameOffset, fields[i].NameLength, members->StringPoolSize) || !isLocalReference(fields[i].FieldType))
+				return false;
+		}
+
+		for (int32_t i = 0; i < members->ParameterCount; i++)
+		{
+			if (!isLocalReference(parameterTypes[i]))
+				return false;
+		}
+
+		InMetadata.Types = table;
+		InMetadata.Members = members;
+		InMetadata.TypeMembers = typeMembers;
+		InMetadata.Methods = methods;
+		InMetadata.Fields = fields;
+		InMetadata.ParameterTypes = parameterTypes;
+		InMetadata.MemberNames = reinterpret_cast<const char*>(parameterTypes + members->ParameterCount);
+		return true;
+	}
+
+	void TypeTableCache::Store(const std::filesystem::path& InFilePath, const TypeTableCacheKey& InKey, const TypeTableHeader* InTypes, const MemberTableHeader* InMembers)
+	{
+		const auto* entries = reinterpret_cast<const TypeTableEntry*>(InTypes + 1);
+		const auto* interfaceIds = reinterpret_cast<const TypeId*>(entries + InTypes->EntryCount);
+		const auto* strings = reinterpret_cast<const char*>(interfaceIds + InTypes->InterfaceCount);
+
+		std::unordered_map<TypeId, TypeId> localReferences;
+		localReferences.reserve(static_cast<size_t>(InTypes->TypeCount));
+		for (int32_t i = 0; i < InTypes->TypeCount; i++)
+			localReferences[entries[i].Id] = i + 1;
+
+		auto toLocalReference = [&localReferences](TypeId InTypeId)
+		{
+			auto it = localReferences.find(InTypeId);
+			return it != localReferences.end() ? it->second : 0;
+		};
+
+		std::vector<TypeTableEntry> localEntries(entries, entries + InTypes->TypeCount);
+		for (auto& entry : localEntries)
+		{
+			// Types defined in another module of a multi-module assembly can't be bound by token, Find would reject the file anyway
+			if (entry.Token == 0)
+				return;
+
+			entry.Id = toLocalReference(entry.Id);
+			entry.BaseTypeId = toLocalReference(entry.BaseTypeId);
+
+			// The marshalled size of a struct can depend on types from other assemblies, which aren't part of the key
+			entry.Size = -1;
+		}
+
+		// Only local types have interfaces, so every interface belongs to one of the entries written above
+		std::vector<TypeId> localInterfaces(interfaceIds, interfaceIds + InTypes->InterfaceCount);
+		for (auto& interfaceId : localInterfaces)
+			interfaceId = toLocalReference(interfaceId);
+
+		TypeTableCacheHeader header = { s_TypeTableCacheMagic, s_TypeTableCacheVersion, InKey };
+
+		TypeTableHeader table = *InTypes;
+		table.EntryCount = table.TypeCount;
+
+		size_t typeTableSize = sizeof(header) + sizeof(table) + localEntries.size() * sizeof(TypeTableEntry) + localInterfaces.size() * sizeof(TypeId) + static_cast<size_t>(table.StringPoolSize);
+		const char padding[4] = {};
+
+		// The MemberTable already refers to types by local reference, so it's written as is
+		size_t memberTableSize = sizeof(MemberTableHeader);
+		memberTableSize += static_cast<size_t>(InMembers->TypeCount) * sizeof(MemberTableType);
+		memberTableSize += static_cast<size_t>(InMembers->MethodCount) * sizeof(MemberTableMethod);
+		memberTableSize += static_cast<size_t>(InMembers->FieldCount) * sizeof(MemberTableField);
+		memberTableSize += static_cast<size_t>(InMembers->ParameterCount) * sizeof(TypeId);
+		memberTableSize += static_cast<size_t>(InMembers->StringPoolSize);
+
+		std::error_code error;
+		std::filesystem::create_directories(InFilePath.parent_path(), error);
+
+		// Written next to the destination first so a concurrent reader never maps a partially written file. Other processes may be
+		// storing the same file at the same time, so every writer gets its own temporary file and the last rename wins.
+#ifdef CORAL_WINDOWS
+		auto processId = static_cast<uint64_t>(GetCurrentProcessId());
+#else
+		auto processId = static_cast<uint64_t>(getpid());
+#endif
+
+		auto tempFilePath = InFilePath;
+		tempFilePath += "." + std::to_string(processId) + "-" + std::to_string(std::random_device()()) + ".tmp";
+
+		{
+			std::ofstream stream(tempFilePath, std::ios::binary | std::ios::trunc);
+			stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			stream.write(reinterpret_cast<const char*>(&table), sizeof(table));
+			stream.write(reinterpret_cast<const char*>(localEntries.data()), static_cast<std::streamsize>(localEntries.size() * sizeof(TypeTableEntry)));
+			stream.write(reinterpret_cast<const char*>(localInterfaces.data()), static_cast<std::streamsize>(localInterfaces.size() * sizeof(TypeId)));
+			stream.write(strings, table.StringPoolSize);
+			stream.write(padding, static_cast<std::streamsize>(AlignMemberTableOffset(typeTableSize) - typeTableSize));
+			stream.write(reinterpret_cast<const char*>(InMembers), static_cast<std::streamsize>(memberTableSize));
+
+			if (!stream)
+			{
+				stream.close();
+				std::filesystem::remove(tempFilePath, error);
+				return;
+			}
+		}
+
+		std::filesystem::rename(tempFilePath, InFilePath, error);
+
+		if (error)
+			std::filesystem::remove(tempFilePath, error);
+	}
+
+}
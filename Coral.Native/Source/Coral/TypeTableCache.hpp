@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Coral/Core.hpp"
+#include "Coral/Type.hpp"
+
+#include "TypeTable.hpp"
+
+#include <filesystem>
+
+namespace Coral {
+
+	// Identifies the exact build of an assembly a cache file was written for. Module version IDs are only regenerated when the
+	// compiler runs, so an image that was patched or re-signed afterwards keeps its ID, which is why the contents are hashed as well.
+	// Reflection also reports members inherited from the runtime's own types, so the runtime build is part of the key too.
+	struct TypeTableCacheKey
+	{
+		uint8_t ModuleVersionId[16];
+		uint8_t CoreLibModuleVersionId[16];
+		uint64_t ImageSize;
+		uint64_t ImageHash;
+
+		// Hashes a whole assembly image, a word at a time since this runs for every assembly loaded with the cache enabled
+		static uint64_t HashImage(const std::byte* InData, size_t InSize);
+	};
+
+	// Read-only view of a whole file, unmapped when the object is destroyed
+	class MappedFile
+	{
+	public:
+		explicit MappedFile(const std::filesystem::path& InFilePath);
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		bool IsValid() const { return m_Data != nullptr; }
+		const std::byte* GetData() const { return m_Data; }
+		size_t GetSize() const { return m_Size; }
+
+	private:
+		const std::byte* m_Data = nullptr;
+		size_t m_Size = 0;
+
+#ifdef CORAL_WINDOWS
+		void* m_File = nullptr;
+		void* m_Mapping = nullptr;
+#endif
+	};
+
+	// A cache file that passed validation, mapped for as long as the types built from it are alive. The tables point into the mapping.
+	struct CachedMetadata
+	{
+		explicit CachedMetadata(const std::filesystem::path& InFilePath)
+			: File(InFilePath) {}
+
+		MappedFile File;
+
+		const TypeTableHeader* Types = nullptr;
+
+		const MemberTableHeader* Members = nullptr;
+		const MemberTableType* TypeMembers = nullptr;
+		const MemberTableMethod* Methods = nullptr;
+		const MemberTableField* Fields = nullptr;
+		const TypeId* ParameterTypes = nullptr;
+		const char* MemberNames = nullptr;
+
+		// The assembly's types built from this file, in the same order as the cached entries, resolves local references
+		std::vector<Type>* LocalTypes = nullptr;
+
+		Type* GetLocalType(TypeId InReference) const { return InReference != 0 ? &(*LocalTypes)[static_cast<size_t>(InReference - 1)] : nullptr; }
+		std::string_view GetMemberName(int32_t InOffset, int32_t InLength) const { return { MemberNames + InOffset, static_cast<size_t>(InLength) }; }
+	};
+
+	// Persists the TypeTable and MemberTable of an assembly between runs. A later load of the same build hands out type IDs that are
+	// only bound to a type the first time they're used, and enumerates methods and fields from the file, so nothing has to reflect
+	// over the assembly until a type or member is actually used.
+	// Type IDs are only valid for the process that handed them out, so a cached table refers to the assembly's own types by local
+	// reference instead: their index in the table + 1, with 0 meaning no type. Types defined by other assemblies are stored as 0 and
+	// resolved on demand.
+	struct TypeTableCache
+	{
+		// One file per build of an assembly, so builds loaded side by side (or switched between) don't overwrite each other's cache
+		static std::filesystem::path GetFilePath(const std::filesystem::path& InDirectory, std::string_view InAssemblyName, const TypeTableCacheKey& InKey);
+
+		// Points InMetadata's tables into its file, returns false if the file was written for a different build or is malformed.
+		// Every local reference and range is guaranteed to be in bounds afterwards.
+		static bool Find(CachedMetadata& InMetadata, const TypeTableCacheKey& InKey);
+
+		// Writes the local entries of tables returned by GetAssemblyTypeTable and GetAssemblyMemberTable, replacing the file atomically
+		static void Store(const std::filesystem::path& InFilePath, const TypeTableCacheKey& InKey, const TypeTableHeader* InTypes, const MemberTableHeader* InMembers);
+	};
+
+}
@@ -0,0 +1,92 @@
+#include "Coral/WeakManagedObject.hpp"
+
+#include "CoralManagedFunctions.hpp"
+
+namespace Coral {
+
+	WeakManagedObject::WeakManagedObject(const ManagedObject& InObject)
+	{
+		if (InObject.m_Handle)
+		{
+			m_Handle = s_ManagedFunctions.CreateWeakReferenceFptr(InObject.m_Handle);
+			m_Type = InObject.m_Type;
+		}
+	}
+
+	WeakManagedObject::WeakManagedObject(const WeakManagedObject& InOther)
+	{
+		if (InOther.m_Handle)
+		{
+			m_Handle = s_ManagedFunctions.CreateWeakReferenceFptr(InOther.m_Handle);
+			m_Type = InOther.m_Type;
+		}
+	}
+
+	WeakManagedObject::WeakManagedObject(WeakManagedObject&& InOther) noexcept : m_Handle(InOther.m_Handle), m_Type(InOther.m_Type)
+	{
+		InOther.m_Handle = nullptr;
+		InOther.m_Type = nullptr;
+	}
+
+	WeakManagedObject::~WeakManagedObject()
+	{
+		Destroy();
+	}
+
+	WeakManagedObject& WeakManagedObject::operator=(const WeakManagedObject& InOther)
+	{
+		if (this != &InOther)
+		{
+			Destroy();
+			if (InOther.m_Handle)
+			{
+				m_Handle = s_ManagedFunctions.CreateWeakReferenceFptr(InOther.m_Handle);
+				m_Type = InOther.m_Type;
+			}
+		}
+
+		return *this;
+	}
+
+	WeakManagedObject& WeakManagedObject::operator=(WeakManagedObject&& InOther) noexcept
+	{
+		if (this != &InOther)
+		{
+			Destroy();
+			m_Handle = InOther.m_Handle;
+			m_Type = InOther.m_Type;
+			InOther.m_Handle = nullptr;
+			InOther.m_Type = nullptr;
+		}
+
+		return *this;
+	}
+
+	ManagedObject WeakManagedObject::TryLock() const
+	{
+		ManagedObject result;
+
+		if (!m_Handle)
+			return result;
+
+		result.m_Handle = s_ManagedFunctions.LockWeakReferenceFptr(m_Handle);
+		result.m_Type = result.m_Handle ? m_Type : nullptr;
+		return result;
+	}
+
+	bool WeakManagedObject::IsAlive() const
+	{
+		return m_Handle && s_ManagedFunctions.IsWeakReferenceAliveFptr(m_Handle);
+	}
+
+	void WeakManagedObject::Destroy()
+	{
+		if (!m_Handle)
+			return;
+
+		s_ManagedFunctions.DestroyObjectFptr(m_Handle);
+		m_Handle = nullptr;
+		m_Type = nullptr;
+	}
+
+}
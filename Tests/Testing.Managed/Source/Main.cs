@@ -65,6 +65,17 @@ namespace Testing.Managed {
 			Console.WriteLine(value);
 		}
 
+		public static long GetAllocatedBytes()
+		{
+			return GC.GetAllocatedBytesForCurrentThread();
+		}
+
+		[NativeCallable, UnmanagedCallersOnly]
+		public static int NativeCallableAdd(int InA, int InB)
+		{
+			return InA + InB;
+		}
+
 		[Test]
 		public bool SByteMarshalTest()
 		{
@@ -18,6 +18,17 @@ public class MemberMethodTest
 		public float Y;
 		public int Z;
 	}
+
+	public int IntConstructorValue;
+	public float FloatConstructorValue;
+
+	public MemberMethodTest() {}
+
+	public MemberMethodTest(int InIntValue, float InFloatValue)
+	{
+		IntConstructorValue = InIntValue;
+		FloatConstructorValue = InFloatValue;
+	}
 	
 	public sbyte SByteTest(sbyte InValue)
 	{
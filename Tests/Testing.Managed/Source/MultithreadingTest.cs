@@ -0,0 +1,26 @@
+﻿namespace Testing.Managed;
+
+// Only used by the multithreading tests. MultithreadedInvokeMethodTest runs first, so its members are still unresolved when its threads start
+public interface IMultithreadingTest {}
+
+public class MultithreadingTestBase {}
+
+public class MultithreadingTest : MultithreadingTestBase, IMultithreadingTest
+{
+	public int Value;
+
+	public MultithreadingTest(int InValue)
+	{
+		Value = InValue;
+	}
+
+	public int Add(int InValue)
+	{
+		return Value + InValue;
+	}
+
+	public int Multiply(int InValue)
+	{
+		return Value * InValue;
+	}
+}
@@ -5,6 +5,8 @@ namespace Testing.Managed
 	public class VirtualMethodTests
 	{
 		public virtual void TestMe() {}
+
+		public virtual int GetOverrideIndex() => 0;
 	}
 
 	public class Override1 : VirtualMethodTests
@@ -13,6 +15,8 @@ namespace Testing.Managed
 		{
 			Console.WriteLine("Override1");
 		}
+
+		public override int GetOverrideIndex() => 1;
 	}
 
 	public class Override2 : VirtualMethodTests
@@ -21,5 +25,16 @@ namespace Testing.Managed
 		{
 			Console.WriteLine("Override2");
 		}
+
+		public override int GetOverrideIndex() => 2;
+	}
+
+	public class GenericMethodTests<T> where T : class
+	{
+		public string GetTypeArgumentName() => typeof(T).Name;
 	}
+
+	public class StringGenericMethodTests : GenericMethodTests<string> {}
+
+	public class ObjectGenericMethodTests : GenericMethodTests<object> {}
 }
@@ -2,9 +2,13 @@
 #include <string>
 #include <vector>
 #include <filesystem>
+#include <fstream>
 #include <chrono>
 #include <functional>
 #include <ranges>
+#include <thread>
+#include <atomic>
+#include <unordered_set>
 
 #include <Coral/HostInstance.hpp>
 #include <Coral/DotnetServices.hpp>
@@ -183,6 +187,653 @@ static void RegisterMemberMethodTests(Coral::ManagedObject& InObject)
 	});
 }
 
+static void RegisterMethodHandleTests(Coral::ManagedObject& InObject)
+{
+	RegisterTest("IntMethodHandleTest", [&InObject]() mutable
+	{
+		auto method = InObject.GetType().GetMethod<int32_t>("IntTest");
+		return method && InObject.InvokeMethod<int32_t, int32_t>(method, 10) == 20;
+	});
+
+	RegisterTest("OverloadMethodHandleTest", [&InObject]() mutable
+	{
+		auto intMethod = InObject.GetType().GetMethod<int32_t>("OverloadTest");
+		auto floatMethod = InObject.GetType().GetMethod<float>("OverloadTest");
+		return InObject.InvokeMethod<int32_t, int32_t>(intMethod, 50) == 1050 && InObject.InvokeMethod<float, float>(floatMethod, 5.0f) == 15.0f;
+	});
+
+	RegisterTest("StringMethodHandleTest", [&InObject]() mutable
+	{
+		auto method = InObject.GetType().GetMethod<Coral::String>("StringTest");
+		Coral::ScopedString str = InObject.InvokeMethod<Coral::String, Coral::String>(method, Coral::String::New("Hello"));
+		return str == "Hello, World!";
+	});
+
+	RegisterTest("DummyStructMethodHandleTest", [&InObject]() mutable
+	{
+		DummyStruct value = { 10, 10.0f, 10 };
+		auto method = InObject.GetType().GetMethod<DummyStruct>("DummyStructTest");
+		auto result = InObject.InvokeMethod<DummyStruct, DummyStruct&>(method, value);
+		return result.X == 20 && result.Y - 20.0f < 0.001f && result.Z == 20;
+	});
+
+	RegisterTest("InvalidMethodHandleTest", [&InObject]() mutable
+	{
+		return !InObject.GetType().GetMethod<int32_t, int32_t>("IntTest");
+	});
+
+	RegisterTest("ZeroAllocationInvokeTest", [&InObject]() mutable
+	{
+		auto getAllocatedBytes = g_TestsType.GetMethod("GetAllocatedBytes");
+		auto intMethod = InObject.GetType().GetMethod<int32_t>("IntTest");
+		auto structMethod = InObject.GetType().GetMethod<DummyStruct>("DummyStructTest");
+		DummyStruct value = { 10, 10.0f, 10 };
+
+		// Warm up so that the invokers are compiled before we start measuring
+		InObject.InvokeMethod<int32_t, int32_t>(intMethod, 10);
+		InObject.InvokeMethod<DummyStruct, DummyStruct&>(structMethod, value);
+		g_TestsType.InvokeStaticMethod<int64_t>(getAllocatedBytes);
+
+		int64_t allocatedBefore = g_TestsType.InvokeStaticMethod<int64_t>(getAllocatedBytes);
+
+		for (int32_t i = 0; i < 1000; i++)
+		{
+			InObject.InvokeMethod<int32_t, int32_t>(intMethod, 10);
+			InObject.InvokeMethod<DummyStruct, DummyStruct&>(structMethod, value);
+		}
+
+		int64_t allocatedAfter = g_TestsType.InvokeStaticMethod<int64_t>(getAllocatedBytes);
+		return allocatedBefore == allocatedAfter;
+	});
+}
+
+static void RegisterConstructorTests(Coral::ManagedObject& InObject)
+{
+	RegisterTest("ConstructorTest", [&InObject]() mutable
+	{
+		auto object = InObject.GetType().CreateInstance(50, 2.5f);
+		bool success = object.GetFieldValue<int32_t>("IntConstructorValue") == 50 && object.GetFieldValue<float>("FloatConstructorValue") == 2.5f;
+		object.Destroy();
+		return success;
+	});
+
+	RegisterTest("ConstructorHandleTest", [&InObject]() mutable
+	{
+		const auto& type = InObject.GetType();
+		auto constructor = type.GetConstructor<int32_t, float>();
+
+		if (!constructor)
+			return false;
+
+		auto object = type.CreateInstance(constructor, 50, 2.5f);
+		bool success = object.GetFieldValue<int32_t>("IntConstructorValue") == 50 && object.GetFieldValue<float>("FloatConstructorValue") == 2.5f;
+		object.Destroy();
+		return success;
+	});
+}
+
+static void RegisterBatchTests(Coral::ManagedObject& InObject)
+{
+	RegisterTest("CreateInstancesTest", [&InObject]() mutable
+	{
+		const auto& type = InObject.GetType();
+		std::vector<Coral::ManagedObject> objects(1024);
+
+		type.CreateInstances(objects.data(), objects.size(), 50, 2.5f);
+
+		bool success = true;
+		for (const auto& object : objects)
+			success &= object.IsValid();
+
+		success &= objects.back().GetFieldValue<int32_t>("IntConstructorValue") == 50;
+
+		Coral::ManagedObject::DestroyBatch(objects.data(), objects.size());
+
+		for (const auto& object : objects)
+			success &= !object.IsValid();
+
+		return success;
+	});
+
+	RegisterTest("InvokeMethodBatchTest", [&InObject]() mutable
+	{
+		const auto& type = InObject.GetType();
+		auto method = type.GetMethod<int32_t>("IntTest");
+
+		std::vector<Coral::ManagedObject> objects;
+		for (int32_t i = 0; i < 16; i++)
+			objects.push_back(type.CreateInstance());
+
+		std::vector<int32_t> results(objects.size(), 0);
+		type.InvokeMethodBatchWithResults<int32_t, int32_t>(method, objects.data(), objects.size(), results.data(), 10);
+		type.InvokeMethodBatch(type.GetMethod("SomeFunction"), objects.data(), objects.size());
+
+		bool success = true;
+		for (auto& object : objects)
+			object.Destroy();
+
+		for (int32_t result : results)
+			success &= result == 20;
+
+		return success;
+	});
+}
+
+// Only registered when passing --benchmark, the timings are too noisy to check on every run
+static void RegisterBatchBenchmarks(Coral::ManagedObject& InObject)
+{
+	RegisterTest("CreateInstancesBenchmark", [&InObject]() mutable
+	{
+		using Clock = std::chrono::high_resolution_clock;
+
+		const auto& type = InObject.GetType();
+		constexpr size_t objectCount = 50000;
+
+		std::vector<Coral::ManagedObject> objects(objectCount);
+
+		auto start = Clock::now();
+		for (auto& object : objects)
+			object = type.CreateInstance(50, 2.5f);
+		auto singleCreateDuration = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+
+		bool success = objects.back().GetFieldValue<int32_t>("IntConstructorValue") == 50;
+
+		start = Clock::now();
+		for (auto& object : objects)
+			object.Destroy();
+		auto singleDestroyDuration = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+
+		start = Clock::now();
+		type.CreateInstances(objects.data(), objects.size(), 50, 2.5f);
+		auto bulkCreateDuration = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+
+		success &= objects.back().GetFieldValue<int32_t>("IntConstructorValue") == 50;
+
+		start = Clock::now();
+		Coral::ManagedObject::DestroyBatch(objects.data(), objects.size());
+		auto bulkDestroyDuration = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+
+		std::cout << "[Benchmark]: Created " << objectCount << " objects in " << singleCreateDuration.count() << "us one at a time, " << bulkCreateDuration.count() << "us in bulk" << std::endl;
+		std::cout << "[Benchmark]: Destroyed " << objectCount << " objects in " << singleDestroyDuration.count() << "us one at a time, " << bulkDestroyDuration.count() << "us in bulk" << std::endl;
+
+		return success;
+	});
+}
+
+static void RegisterObjectLifetimeTests(Coral::ManagedObject& InObject)
+{
+	RegisterTest("ManagedObjectCopyTest", [&InObject]() mutable
+	{
+		const auto& type = InObject.GetType();
+		auto object = type.CreateInstance(42, 1.0f);
+
+		std::vector<Coral::ManagedObject> copies(8, object);
+		Coral::ManagedObject assigned;
+		assigned = copies[0];
+
+		bool success = assigned.m_Handle == object.m_Handle;
+		for (const auto& copy : copies)
+			success &= copy.m_Handle == object.m_Handle;
+
+		// The handle must stay alive until the last copy is gone
+		object.Destroy();
+		Coral::ManagedObject::DestroyBatch(copies.data(), copies.size());
+		success &= assigned.GetFieldValue<int32_t>("IntConstructorValue") == 42;
+
+		Coral::WeakManagedObject weak(assigned);
+		assigned.Destroy();
+		Coral::GC::Collect();
+		Coral::GC::WaitForPendingFinalizers();
+
+		return success && !weak.IsAlive();
+	});
+
+	RegisterTest("WeakManagedObjectTest", [&InObject]() mutable
+	{
+		const auto& type = InObject.GetType();
+		auto object = type.CreateInstance(42, 1.0f);
+
+		Coral::WeakManagedObject weak(object);
+		{
+			auto locked = weak.TryLock();
+			if (!locked.IsValid() || locked.GetFieldValue<int32_t>("IntConstructorValue") != 42)
+				return false;
+			locked.Destroy();
+		}
+
+		object.Destroy();
+		Coral::GC::Collect();
+		Coral::GC::WaitForPendingFinalizers();
+
+		return !weak.IsAlive() && !weak.TryLock().IsValid();
+	});
+
+	RegisterTest("CreateInstanceWeakTest", [&InObject]() mutable
+	{
+		auto weak = InObject.GetType().CreateInstanceWeak();
+		if (!weak.IsValid())
+			return false;
+
+		Coral::GC::Collect();
+		Coral::GC::WaitForPendingFinalizers();
+		return !weak.TryLock().IsValid();
+	});
+}
+
+static void RegisterInlineMethodCacheTests(Coral::ManagedObject& InObject)
+{
+	RegisterTest("InlineMethodCacheTest", [&InObject]() mutable
+	{
+		// IntTest and OverloadTest share one InvokeMethod<int32_t, int32_t> instantiation, the cache has to tell them apart by name
+		bool success = true;
+		for (int32_t i = 0; i < 8; i++)
+		{
+			success &= InObject.InvokeMethod<int32_t, int32_t>("IntTest", int32_t(i)) == i * 2;
+			success &= InObject.InvokeMethod<int32_t, int32_t>("OverloadTest", int32_t(i)) == i + 1000;
+		}
+
+		return success;
+	});
+
+	RegisterTest("InlineMethodCacheOverloadTest", [&InObject]() mutable
+	{
+		// Both overloads go through one cache, which has to tell them apart by their parameter types
+		Coral::InlineMethodCache cache;
+		bool success = true;
+		for (int32_t i = 0; i < 8; i++)
+		{
+			success &= InObject.InvokeMethod<int32_t, int32_t>(cache, "OverloadTest", int32_t(i)) == i + 1000;
+			success &= InObject.InvokeMethod<float, float>(cache, "OverloadTest", float(i)) - (i + 1000.0f) < 0.001f;
+		}
+
+		return success;
+	});
+
+	RegisterTest("InlineMethodCacheManyMethodsTest", [&InObject]() mutable
+	{
+		auto getAllocatedBytes = g_TestsType.GetMethod("GetAllocatedBytes");
+
+		// Looking a method up by name allocates, so if none of the calls miss after the first round nothing is allocated
+		auto invokeAll = [&InObject]()
+		{
+			bool success = InObject.InvokeMethod<int8_t, int8_t>("SByteTest", 10) == 20;
+			success &= InObject.InvokeMethod<uint8_t, uint8_t>("ByteTest", 10) == 20;
+			success &= InObject.InvokeMethod<int16_t, int16_t>("ShortTest", 10) == 20;
+			success &= InObject.InvokeMethod<uint16_t, uint16_t>("UShortTest", 10) == 20;
+			success &= InObject.InvokeMethod<int32_t, int32_t>("IntTest", 10) == 20;
+			success &= InObject.InvokeMethod<uint32_t, uint32_t>("UIntTest", 10) == 20;
+			success &= InObject.InvokeMethod<int64_t, int64_t>("LongTest", 10) == 20;
+			success &= InObject.InvokeMethod<uint64_t, uint64_t>("ULongTest", 10) == 20;
+			return success;
+		};
+
+		bool success = invokeAll();
+		g_TestsType.InvokeStaticMethod<int64_t>(getAllocatedBytes);
+
+		// The runtime can allocate on this thread by itself now and then (e.g when tiered compilation promotes a method),
+		// a cache that misses allocates in every round though, so one clean round out of a few is enough
+		bool allocationFree = false;
+
+		for (int32_t round = 0; round < 5 && !allocationFree; round++)
+		{
+			int64_t allocatedBefore = g_TestsType.InvokeStaticMethod<int64_t>(getAllocatedBytes);
+
+			for (int32_t i = 0; i < 100; i++)
+				success &= invokeAll();
+
+			int64_t allocatedAfter = g_TestsType.InvokeStaticMethod<int64_t>(getAllocatedBytes);
+			allocationFree = allocatedBefore == allocatedAfter;
+		}
+
+		return success && allocationFree;
+	});
+}
+
+static void RegisterMultithreadingTests(Coral::ManagedAssembly& InAssembly)
+{
+	RegisterTest("MultithreadedInvokeMethodTest", [&InAssembly]() mutable
+	{
+		// Nothing else touches MultithreadingTest, so every thread races to resolve the same members on both sides
+		auto& type = InAssembly.GetLocalType("Testing.Managed.MultithreadingTest");
+		std::atomic<bool> start = false;
+		std::atomic<bool> success = true;
+		std::vector<std::thread> threads;
+
+		for (int32_t t = 0; t < 8; t++)
+		{
+			threads.emplace_back([&type, &start, &success, t]()
+			{
+				while (!start.load())
+					std::this_thread::yield();
+
+				auto object = type.CreateInstance(t);
+				auto multiplyMethod = type.GetMethod<int32_t>("Multiply");
+				bool threadSuccess = multiplyMethod && object.GetType().GetTypeId() == type.GetTypeId();
+
+				Coral::ScopedString baseName = type.GetBaseType().GetFullName();
+				threadSuccess &= baseName == "Testing.Managed.MultithreadingTestBase" && type.GetInterfaceTypes().size() == 1;
+
+				for (int32_t i = 0; i < 1000 && threadSuccess; i++)
+				{
+					threadSuccess = object.InvokeMethod<int32_t, int32_t>("Add", int32_t(i)) == t + i &&
+						object.InvokeMethod<int32_t, int32_t>(multiplyMethod, int32_t(i)) == t * i &&
+						object.GetFieldValue<int32_t>("Value") == t;
+				}
+
+				if (!threadSuccess)
+					success = false;
+
+				object.Destroy();
+			});
+		}
+
+		start = true;
+
+		for (auto& thread : threads)
+			thread.join();
+
+		return success.load();
+	});
+
+	RegisterTest("MultithreadedObjectHandleTest", [&InAssembly]() mutable
+	{
+		// Readers look their objects up while other threads keep allocating and freeing handles, growing the table and reusing slots under them
+		auto& type = InAssembly.GetLocalType("Testing.Managed.MultithreadingTest");
+		auto multiplyMethod = type.GetMethod<int32_t>("Multiply");
+		std::atomic<int32_t> runningWriters = 4;
+		std::atomic<bool> success = true;
+		std::vector<std::thread> threads;
+
+		for (int32_t t = 0; t < 4; t++)
+		{
+			threads.emplace_back([&type, &runningWriters, &success, t]()
+			{
+				std::vector<Coral::ManagedObject> objects(2048);
+
+				for (int32_t i = 0; i < 8; i++)
+				{
+					type.CreateInstances(objects.data(), objects.size(), t);
+
+					if (objects.back().GetFieldValue<int32_t>("Value") != t)
+						success = false;
+
+					Coral::ManagedObject::DestroyBatch(objects.data(), objects.size());
+				}
+
+				runningWriters--;
+			});
+		}
+
+		for (int32_t t = 0; t < 4; t++)
+		{
+			threads.emplace_back([&type, &multiplyMethod, &runningWriters, &success, t]()
+			{
+				auto object = type.CreateInstance(t);
+				bool threadSuccess = true;
+
+				for (int32_t i = 0; runningWriters.load() > 0 && threadSuccess; i++)
+				{
+					auto temporary = type.CreateInstance(i);
+					threadSuccess = object.InvokeMethod<int32_t, int32_t>(multiplyMethod, int32_t(i)) == t * i && temporary.GetFieldValue<int32_t>("Value") == i;
+					temporary.Destroy();
+				}
+
+				if (!threadSuccess)
+					success = false;
+
+				object.Destroy();
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		return success.load();
+	});
+}
+
+static void RegisterNameIdTests(Coral::HostInstance& InHost, Coral::ManagedObject& InFieldObject, Coral::ManagedObject& InMethodObject)
+{
+	RegisterTest("InternNameTest", [&InHost]() mutable
+	{
+		auto name = InHost.InternName("IntTest");
+		return name.IsValid() && name == InHost.InternName("IntTest") && name != InHost.InternName("StringTest");
+	});
+
+	RegisterTest("NameIdMethodTest", [&InHost, &InMethodObject]() mutable
+	{
+		auto intTest = InHost.InternName("IntTest");
+		auto stringTest = InHost.InternName("StringTest");
+
+		Coral::ScopedString str = InMethodObject.InvokeMethod<Coral::String, Coral::String>(stringTest, Coral::String::New("Hello"));
+		return InMethodObject.InvokeMethod<int32_t, int32_t>(intTest, 10) == 20 && str == "Hello, World!";
+	});
+
+	RegisterTest("NameIdFieldTest", [&InHost, &InFieldObject]() mutable
+	{
+		auto intField = InHost.InternName("IntFieldTest");
+		auto boolField = InHost.InternName("BoolFieldTest");
+		auto stringField = InHost.InternName("StringFieldTest");
+
+		InFieldObject.SetFieldValue<int32_t>(intField, 30);
+		InFieldObject.SetFieldValue(boolField, true);
+		InFieldObject.SetFieldValue<std::string>(stringField, "NameId");
+
+		return InFieldObject.GetFieldValue<int32_t>(intField) == 30 && InFieldObject.GetFieldValue<int32_t>("IntFieldTest") == 30 &&
+			InFieldObject.GetFieldValue<bool>(boolField) && InFieldObject.GetFieldValue<std::string>(stringField) == "NameId";
+	});
+
+	RegisterTest("NameIdPropertyTest", [&InHost, &InFieldObject]() mutable
+	{
+		auto intProperty = InHost.InternName("IntPropertyTest");
+		auto boolProperty = InHost.InternName("BoolPropertyTest");
+		auto stringProperty = InHost.InternName("StringPropertyTest");
+
+		InFieldObject.SetPropertyValue<int32_t>(intProperty, 40);
+		InFieldObject.SetPropertyValue(boolProperty, true);
+		InFieldObject.SetPropertyValue<std::string>(stringProperty, "NameId");
+
+		return InFieldObject.GetPropertyValue<int32_t>(intProperty) == 40 && InFieldObject.GetPropertyValue<int32_t>("IntPropertyTest") == 40 &&
+			InFieldObject.GetPropertyValue<bool>(boolProperty) && InFieldObject.GetPropertyValue<std::string>(stringProperty) == "NameId";
+	});
+}
+
+static void RegisterTypeIdTests(Coral::ManagedAssembly& InAssembly)
+{
+	RegisterTest("DenseTypeIdTest", [&InAssembly]() mutable
+	{
+		// Every type gets its own ID, 0 is reserved for "no type"
+		std::unordered_set<Coral::TypeId> ids;
+		for (const auto& type : InAssembly.GetLocalTypes())
+		{
+			if (type.GetTypeId() == 0 || !ids.insert(type.GetTypeId()).second)
+				return false;
+
+			if (&InAssembly.GetLocalType(type.GetTypeId()) != &type)
+				return false;
+		}
+
+		return !ids.empty();
+	});
+
+	RegisterTest("LocalTypeLookupTest", [&InAssembly]() mutable
+	{
+		// Only types the assembly defines are found by name, not arrays of them or types that don't exist
+		auto& type = InAssembly.GetLocalType("Testing.Managed.DummyClass");
+		Coral::ScopedString name = type.GetFullName();
+		if (type.GetTypeId() <= 0 || name != "Testing.Managed.DummyClass")
+			return false;
+
+		if (InAssembly.GetLocalType("Testing.Managed.DummyClass[]").GetTypeId() != -1 || InAssembly.GetLocalType("Testing.Managed.DoesNotExist").GetTypeId() != -1)
+			return false;
+
+		return InAssembly.GetLocalType(type.GetTypeId()).GetTypeId() == type.GetTypeId();
+	});
+
+	RegisterTest("TypeNameKeyTest", [&InAssembly]() mutable
+	{
+		// Hashed at compile time, looking it up doesn't have to hash or copy the name
+		static constexpr Coral::TypeNameKey dummyClassName("Testing.Managed.DummyClass");
+		static_assert(dummyClassName.GetHash() == Coral::TypeNameKey::Hash("Testing.Managed.DummyClass"));
+
+		std::string name = "Testing.Managed.DummyClass";
+		auto& type = InAssembly.GetLocalType(dummyClassName);
+
+		return type.GetTypeId() > 0 && &type == &InAssembly.GetLocalType(name) && &type == &InAssembly.GetLocalType(std::string_view(name));
+	});
+
+	RegisterTest("TypeTableMetadataTest", [&InAssembly]() mutable
+	{
+		auto& type = InAssembly.GetLocalType("Testing.Managed.MultiInheritanceTest");
+		auto& structType = InAssembly.GetLocalType("Testing.Managed.DummyStruct");
+
+		Coral::ScopedString baseName = type.GetBaseType().GetFullName();
+		const auto& interfaceTypes = type.GetInterfaceTypes();
+
+		return baseName == "Testing.Managed.DummyBase" && interfaceTypes.size() == 2 && !type.IsSZArray() &&
+			structType.GetSize() == sizeof(float) && structType.GetManagedType() == Coral::ManagedType::Unknown;
+	});
+}
+
+// Unloading a context clears every type and member cache, so these have to run once every other test is done
+static void RegisterTypeTableCacheTests(Coral::HostInstance& InHost, std::string InAssemblyPath, std::string InDllPath, std::filesystem::path InCacheDirectory)
+{
+	RegisterTest("TypeTableCacheTest", [&InHost, InAssemblyPath, InDllPath, InCacheDirectory]() mutable
+	{
+		std::filesystem::remove_all(InCacheDirectory);
+
+		// The first load reflects over the types and writes the cache file, with lazy type loading once the types are enumerated
+		auto writeContext = InHost.CreateAssemblyLoadContext("TypeTableCacheWriteTest", InDllPath);
+		writeContext.SetTypeTableCacheDirectory(InCacheDirectory.string());
+		const auto& types = writeContext.LoadAssembly(InAssemblyPath).GetLocalTypes();
+
+		// Exactly one file named after the assembly and its build, no temporary files left behind
+		std::vector<std::filesystem::path> cacheFiles;
+		for (const auto& entry : std::filesystem::directory_iterator(InCacheDirectory))
+			cacheFiles.push_back(entry.path());
+
+		bool success = cacheFiles.size() == 1 && cacheFiles[0].extension() == ".coraltypes" && cacheFiles[0].stem().string().rfind("Testing.Managed-", 0) == 0;
+		auto writeTime = success ? std::filesystem::last_write_time(cacheFiles[0]) : std::filesystem::file_time_type();
+
+		// Loading the same build again builds the types from that file instead of writing a new one
+		auto readContext = InHost.CreateAssemblyLoadContext("TypeTableCacheReadTest", InDllPath);
+		readContext.SetTypeTableCacheDirectory(InCacheDirectory.string());
+		auto& cachedAssembly = readContext.LoadAssembly(InAssemblyPath);
+		const auto& cachedTypes = cachedAssembly.GetLocalTypes();
+
+		success = success && cachedTypes.size() == types.size() && std::filesystem::last_write_time(cacheFiles[0]) == writeTime;
+
+		for (size_t i = 0; success && i < types.size(); i++)
+		{
+			Coral::ScopedString name = types[i].GetFullName();
+			Coral::ScopedString cachedName = cachedTypes[i].GetFullName();
+			success = name == cachedName && cachedTypes[i].GetTypeId() != types[i].GetTypeId();
+		}
+
+		if (success)
+		{
+			auto& type = cachedAssembly.GetLocalType("Testing.Managed.MultiInheritanceTest");
+			auto& structType = cachedAssembly.GetLocalType("Testing.Managed.DummyStruct");
+			Coral::ScopedString baseName = type.GetBaseType().GetFullName();
+
+			success = baseName == "Testing.Managed.DummyBase" && type.GetBaseType().GetTypeId() == cachedAssembly.GetLocalType("Testing.Managed.DummyBase").GetTypeId() &&
+				type.GetInterfaceTypes().size() == 2 && structType.GetSize() == sizeof(float) && structType.GetManagedType() == Coral::ManagedType::Unknown;
+		}
+
+		// Methods and fields of the cached types are enumerated from the file, they have to match what the runtime reported the first time
+		for (size_t i = 0; success && i < types.size(); i++)
+		{
+			auto methods = types[i].GetMethods();
+			auto cachedMethods = cachedTypes[i].GetMethods();
+			auto fields = types[i].GetFields();
+			auto cachedFields = cachedTypes[i].GetFields();
+			success = methods.size() == cachedMethods.size() && fields.size() == cachedFields.size();
+
+			for (size_t j = 0; success && j < methods.size(); j++)
+			{
+				Coral::ScopedString name = methods[j].GetName();
+				Coral::ScopedString cachedName = cachedMethods[j].GetName();
+				Coral::ScopedString returnTypeName = methods[j].GetReturnType().GetFullName();
+				Coral::ScopedString cachedReturnTypeName = cachedMethods[j].GetReturnType().GetFullName();
+
+				success = name == cachedName && returnTypeName == cachedReturnTypeName && methods[j].GetAccessibility() == cachedMethods[j].GetAccessibility() &&
+					methods[j].GetParameterTypes().size() == cachedMethods[j].GetParameterTypes().size();
+			}
+
+			for (size_t j = 0; success && j < fields.size(); j++)
+			{
+				Coral::ScopedString name = fields[j].GetName();
+				Coral::ScopedString cachedName = cachedFields[j].GetName();
+				Coral::ScopedString typeName = fields[j].GetType().GetFullName();
+				Coral::ScopedString cachedTypeName = cachedFields[j].GetType().GetFullName();
+
+				success = name == cachedName && typeName == cachedTypeName && fields[j].GetAccessibility() == cachedFields[j].GetAccessibility();
+			}
+		}
+
+		// Attributes aren't cached, asking for them resolves the member through the runtime
+		if (success)
+		{
+			success = false;
+
+			for (auto& field : cachedAssembly.GetLocalType("Testing.Managed.FieldMarshalTest").GetFields())
+			{
+				Coral::ScopedString name = field.GetName();
+
+				if (name == "AttributeFieldTest")
+				{
+					auto attributes = field.GetAttributes();
+					success = attributes.size() == 1 && attributes[0].GetFieldValue<float>("SomeValue") == 1000.0f;
+				}
+			}
+		}
+
+		// Patching an image after it was compiled keeps its module version ID, so the contents have to tell the two builds apart.
+		// The PE checksum isn't verified for managed assemblies, which makes it a safe byte to change.
+		auto patchedDirectory = InCacheDirectory.parent_path() / "TypeTableCachePatched";
+		auto patchedAssemblyPath = patchedDirectory / std::filesystem::path(InAssemblyPath).filename();
+		std::filesystem::create_directories(patchedDirectory);
+		std::filesystem::copy_file(InAssemblyPath, patchedAssemblyPath, std::filesystem::copy_options::overwrite_existing);
+
+		{
+			std::fstream image(patchedAssemblyPath, std::ios::binary | std::ios::in | std::ios::out);
+			uint32_t peHeaderOffset = 0;
+			image.seekg(0x3C);
+			image.read(reinterpret_cast<char*>(&peHeaderOffset), sizeof(peHeaderOffset));
+
+			// PE signature + COFF file header, followed by the optional header which stores the checksum at offset 64
+			uint32_t checksum = 0;
+			image.seekg(peHeaderOffset + 4 + 20 + 64);
+			image.read(reinterpret_cast<char*>(&checksum), sizeof(checksum));
+			checksum = ~checksum;
+			image.seekp(peHeaderOffset + 4 + 20 + 64);
+			image.write(reinterpret_cast<const char*>(&checksum), sizeof(checksum));
+			success &= static_cast<bool>(image);
+		}
+
+		auto patchedContext = InHost.CreateAssemblyLoadContext("TypeTableCachePatchedTest", InDllPath);
+		patchedContext.SetTypeTableCacheDirectory(InCacheDirectory.string());
+		success &= patchedContext.LoadAssembly(patchedAssemblyPath.string()).GetLocalTypes().size() == types.size();
+
+		// The patched image gets a cache file of its own instead of reusing the original one
+		size_t cacheFileCount = 0;
+		for (const auto& entry : std::filesystem::directory_iterator(InCacheDirectory))
+			cacheFileCount += entry.path().extension() == ".coraltypes";
+
+		success = success && cacheFileCount == 2 && std::filesystem::last_write_time(cacheFiles[0]) == writeTime;
+
+		InHost.UnloadAssemblyLoadContext(patchedContext);
+		InHost.UnloadAssemblyLoadContext(readContext);
+		InHost.UnloadAssemblyLoadContext(writeContext);
+		std::filesystem::remove_all(InCacheDirectory);
+
+		// The runtime may still have the patched image open until the context is collected
+		std::error_code error;
+		std::filesystem::remove_all(patchedDirectory, error);
+		return success;
+	});
+}
+
 static void RegisterFieldMarshalTests(Coral::ManagedObject& InObject)
 {
 	RegisterTest("SByteFieldTest", [&InObject]() mutable
@@ -430,6 +1081,86 @@ static void RegisterFieldMarshalTests(Coral::ManagedObject& InObject)
 	});
 }
 
+static void RegisterAccessorTests(Coral::ManagedObject& InObject)
+{
+	RegisterTest("IntFieldAccessorTest", [&InObject]() mutable
+	{
+		auto field = InObject.GetType().GetFieldAccessor("IntFieldTest");
+		InObject.SetFieldValue<int32_t>(field, 30);
+		return InObject.GetFieldValue<int32_t>(field) == 30 && InObject.GetFieldValue<int32_t>("IntFieldTest") == 30;
+	});
+
+	RegisterTest("FloatFieldAccessorTest", [&InObject]() mutable
+	{
+		auto field = InObject.GetType().GetFieldAccessor("FloatFieldTest");
+		InObject.SetFieldValue<float>(field, 30.0f);
+		return InObject.GetFieldValue<float>(field) - 30.0f < 0.001f;
+	});
+
+	RegisterTest("BoolFieldAccessorTest", [&InObject]() mutable
+	{
+		auto field = InObject.GetType().GetFieldAccessor("BoolFieldTest");
+		InObject.SetFieldValue<bool>(field, false);
+		if (InObject.GetFieldValue<bool>(field))
+			return false;
+
+		InObject.SetFieldValue<bool>(field, true);
+		return InObject.GetFieldValue<bool>(field);
+	});
+
+	RegisterTest("StringFieldAccessorTest", [&InObject]() mutable
+	{
+		auto field = InObject.GetType().GetFieldAccessor("StringFieldTest");
+		InObject.SetFieldValue<std::string>(field, "Hello, Accessor!");
+		return InObject.GetFieldValue<std::string>(field) == "Hello, Accessor!";
+	});
+
+	RegisterTest("InvalidFieldAccessorTest", [&InObject]() mutable
+	{
+		return !InObject.GetType().GetFieldAccessor("DoesNotExist");
+	});
+
+	RegisterTest("IntPropertyAccessorTest", [&InObject]() mutable
+	{
+		auto property = InObject.GetType().GetPropertyAccessor("IntPropertyTest");
+		InObject.SetPropertyValue<int32_t>(property, 30);
+		return InObject.GetPropertyValue<int32_t>(property) == 30 && InObject.GetPropertyValue<int32_t>("IntPropertyTest") == 30;
+	});
+
+	RegisterTest("BoolPropertyAccessorTest", [&InObject]() mutable
+	{
+		auto property = InObject.GetType().GetPropertyAccessor("BoolPropertyTest");
+		InObject.SetPropertyValue<Coral::Bool32>(property, false);
+		if (InObject.GetPropertyValue<Coral::Bool32>(property))
+			return false;
+
+		InObject.SetPropertyValue<Coral::Bool32>(property, true);
+		return static_cast<bool>(InObject.GetPropertyValue<Coral::Bool32>(property));
+	});
+
+	RegisterTest("StringPropertyAccessorTest", [&InObject]() mutable
+	{
+		auto property = InObject.GetType().GetPropertyAccessor("StringPropertyTest");
+		Coral::ScopedString newValue = Coral::String::New("Hello, Accessor!");
+		InObject.SetPropertyValue<Coral::String>(property, newValue);
+		Coral::ScopedString value = InObject.GetPropertyValue<Coral::String>(property);
+		return value == "Hello, Accessor!";
+	});
+
+	RegisterTest("NativeTypePropertyAccessorTest", [&InObject]() mutable
+	{
+		// bool and std::string are converted to Bool32 and String, like they are for fields
+		auto boolProperty = InObject.GetType().GetPropertyAccessor("BoolPropertyTest");
+		auto stringProperty = InObject.GetType().GetPropertyAccessor("StringPropertyTest");
+
+		InObject.SetPropertyValue(boolProperty, true);
+		InObject.SetPropertyValue(stringProperty, std::string("Hello, bool!"));
+
+		return InObject.GetPropertyValue<bool>(boolProperty) && InObject.GetPropertyValue<std::string>(stringProperty) == "Hello, bool!" &&
+			InObject.GetPropertyValue<bool>("BoolPropertyTest") && InObject.GetPropertyValue<std::string>("StringPropertyTest") == "Hello, bool!";
+	});
+}
+
 static void RunTests()
 {
 	size_t passedTests = 0;
@@ -450,13 +1181,23 @@ static void RunTests()
 	std::cout << "[NativeTest]: Done. " << passedTests << " passed, " << tests.size() - passedTests  << " failed.\n";
 }
 
-int main([[maybe_unused]] int argc, char** argv)
+int main(int argc, char** argv)
 {
 	auto exeDir = std::filesystem::path(argv[0]).parent_path();
 	auto coralDir = exeDir.string();
 	Coral::HostSettings settings;
 	settings.CoralDirectory = coralDir;
 	settings.ExceptionCallback = ExceptionCallback;
+	// Pass --lazy-type-loading to only resolve types when they're looked up, --gc-handles to keep objects alive with raw GCHandles
+	// instead of the managed handle table, and --benchmark to also run the benchmarks
+	bool runBenchmarks = false;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string_view arg = argv[i];
+		settings.LazyTypeLoading |= arg == "--lazy-type-loading";
+		settings.UseObjectHandleTable &= arg != "--gc-handles";
+		runBenchmarks |= arg == "--benchmark";
+	}
 	Coral::HostInstance hostInstance;
 	hostInstance.Initialize(settings);
 
@@ -475,6 +1216,81 @@ int main([[maybe_unused]] int argc, char** argv)
 	g_TestsType = testsType;
 	testsType.InvokeStaticMethod("StaticMethodTest", 50.0f);
 	testsType.InvokeStaticMethod("StaticMethodTest", 1000);
+	testsType.InvokeStaticMethod(testsType.GetMethod<float>("StaticMethodTest"), 75.0f);
+	testsType.InvokeStaticMethod(hostInstance.InternName("StaticMethodTest"), 100);
+
+	RegisterTest("NativeCallableTest", [&assembly]() mutable
+	{
+		auto add = assembly.GetFunctionPointer<int32_t(int32_t, int32_t)>("Testing.Managed.Tests", "NativeCallableAdd");
+		return add != nullptr && add(10, 20) == 30;
+	});
+
+	// Raw GCHandles can't tell a stale handle apart from a live one
+	if (settings.UseObjectHandleTable)
+	{
+		RegisterTest("StaleObjectHandleTest", [&assembly]() mutable
+		{
+			auto& type = assembly.GetLocalType("Testing.Managed.MemberMethodTest");
+			auto object = type.CreateInstance(1, 1.0f);
+			void* staleHandle = object.m_Handle;
+			object.Destroy();
+
+			// Reuses the freed slot with a new generation, so the stale handle must not alias it
+			auto newObject = type.CreateInstance(42, 1.0f);
+
+			Coral::ManagedObject staleObject;
+			staleObject.m_Handle = staleHandle;
+			staleObject.m_Type = &type;
+
+			// Using the stale handle is reported and leaves the field untouched instead of writing to newObject
+			staleObject.SetFieldValue<int32_t>("IntConstructorValue", 7);
+			staleObject.Destroy();
+
+			bool success = newObject.m_Handle != staleHandle && newObject.GetFieldValue<int32_t>("IntConstructorValue") == 42;
+			newObject.Destroy();
+			return success;
+		});
+	}
+
+	RegisterTest("GenericInstantiationMethodTest", [&assembly]() mutable
+	{
+		// Both methods are inherited from instantiations of the same generic type, which share their method handles
+		auto& stringType = assembly.GetLocalType("Testing.Managed.StringGenericMethodTests");
+		auto& objectType = assembly.GetLocalType("Testing.Managed.ObjectGenericMethodTests");
+		auto stringObject = stringType.CreateInstance();
+		auto objectObject = objectType.CreateInstance();
+
+		Coral::ScopedString stringName = stringObject.InvokeMethod<Coral::String>("GetTypeArgumentName");
+		Coral::ScopedString objectName = objectObject.InvokeMethod<Coral::String>("GetTypeArgumentName");
+		Coral::ScopedString stringHandleName = stringObject.InvokeMethod<Coral::String>(stringType.GetMethod("GetTypeArgumentName"));
+		Coral::ScopedString objectHandleName = objectObject.InvokeMethod<Coral::String>(objectType.GetMethod("GetTypeArgumentName"));
+
+		bool success = stringName == "String" && objectName == "Object" && stringHandleName == "String" && objectHandleName == "Object";
+
+		stringObject.Destroy();
+		objectObject.Destroy();
+		return success;
+	});
+
+	RegisterTest("NameIdOverrideTest", [&assembly, &hostInstance]() mutable
+	{
+		// Each runtime type resolves the name to its own override, alternating receivers must never pick up the other's
+		auto getOverrideIndex = hostInstance.InternName("GetOverrideIndex");
+		auto object1 = assembly.GetLocalType("Testing.Managed.Override1").CreateInstance();
+		auto object2 = assembly.GetLocalType("Testing.Managed.Override2").CreateInstance();
+
+		bool success = true;
+		for (int32_t i = 0; i < 4; i++)
+		{
+			success &= object1.InvokeMethod<int32_t>(getOverrideIndex) == 1;
+			success &= object2.InvokeMethod<int32_t>(getOverrideIndex) == 2;
+			success &= object1.InvokeMethod<int32_t>("GetOverrideIndex") == 1;
+		}
+
+		object1.Destroy();
+		object2.Destroy();
+		return success;
+	});
 
 	auto& instanceTestType = assembly.GetLocalType("Testing.Managed.InstanceTest");
 	instance = instanceTestType.CreateInstance();
@@ -552,7 +1368,18 @@ int main([[maybe_unused]] int argc, char** argv)
 	auto memberMethodTest = memberMethodTestType.CreateInstance();
 
 	RegisterFieldMarshalTests(fieldTestObject);
+	RegisterAccessorTests(fieldTestObject);
 	RegisterMemberMethodTests(memberMethodTest);
+	RegisterMethodHandleTests(memberMethodTest);
+	RegisterConstructorTests(memberMethodTest);
+	RegisterBatchTests(memberMethodTest);
+	if (runBenchmarks)
+		RegisterBatchBenchmarks(memberMethodTest);
+	RegisterObjectLifetimeTests(memberMethodTest);
+	RegisterInlineMethodCacheTests(memberMethodTest);
+	RegisterMultithreadingTests(assembly);
+	RegisterNameIdTests(hostInstance, fieldTestObject, memberMethodTest);
+	RegisterTypeIdTests(assembly);
 	RunTests();
 
 	memberMethodTest.Destroy();
@@ -567,6 +1394,11 @@ int main([[maybe_unused]] int argc, char** argv)
 	instance1.InvokeMethod("TestMe");
 	instance2.InvokeMethod("TestMe");
 
+	// A handle resolved on the base type dispatches to each override.
+	auto testMeMethod = assembly.GetLocalType("Testing.Managed.VirtualMethodTests").GetMethod("TestMe");
+	instance1.InvokeMethod(testMeMethod);
+	instance2.InvokeMethod(testMeMethod);
+
 	instance.Destroy();
 	instance1.Destroy();
 	instance2.Destroy();
@@ -616,5 +1448,9 @@ int main([[maybe_unused]] int argc, char** argv)
 	testsInstance2.Destroy();
 	instance.Destroy();
 
+	tests.clear();
+	RegisterTypeTableCacheTests(hostInstance, assemblyPath.string(), testDllPath, exeDir / "TypeTableCache");
+	RunTests();
+
 	return 0;
 }